@@ -0,0 +1,137 @@
+#ifndef _ZIM_TOOL_ARENA_H_
+#define _ZIM_TOOL_ARENA_H_
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+/**
+ * Arena is a monotonic allocator for short-lived temporaries (like the ones
+ * created while checking an item): memory is carved out of fixed-size chunks
+ * and is released all at once by reset(). The chunks are kept for reuse, so
+ * that in the steady state allocating from the arena doesn't touch the heap.
+ *
+ * Requests larger than a quarter of a chunk get their own block. These blocks
+ * are kept too: reset() makes them available for the next large requests
+ * (the smallest block big enough is reused). An Arena is not thread-safe.
+ */
+class Arena
+{
+public: // functions
+  explicit Arena(size_t _chunkSize = 64*1024)
+    : chunkSize(_chunkSize)
+    , used(_chunkSize)
+  {}
+
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+
+  void* allocate(size_t size, size_t alignment = alignof(std::max_align_t))
+  {
+    if ( size > chunkSize / 4 ) {
+      return allocateLargeBlock(size);
+    }
+
+    size_t offset = (used + alignment - 1) & ~(alignment - 1);
+    if ( offset + size > chunkSize ) {
+      if ( chunksInUse == chunks.size() ) {
+        chunks.emplace_back(new char[chunkSize]);
+      }
+      ++chunksInUse;
+      offset = 0;
+    }
+    used = offset + size;
+    return chunks[chunksInUse - 1].get() + offset;
+  }
+
+  // Returns a copy of s stored in the arena
+  std::string_view copy(std::string_view s)
+  {
+    if ( s.empty() )
+      return std::string_view();
+
+    char* const p = static_cast<char*>(allocate(s.size(), 1));
+    memcpy(p, s.data(), s.size());
+    return std::string_view(p, s.size());
+  }
+
+  // Releases all the memory allocated from the arena
+  void reset()
+  {
+    chunksInUse = 0;
+    used = chunkSize;
+    largeBlocksInUse = 0;
+  }
+
+private: // types
+  struct LargeBlock
+  {
+    std::unique_ptr<char[]> data;
+    size_t size;
+  };
+
+private: // functions
+  void* allocateLargeBlock(size_t size)
+  {
+    // The blocks in use are at the front of largeBlocks
+    size_t best = largeBlocks.size();
+    for ( size_t i = largeBlocksInUse; i < largeBlocks.size(); ++i ) {
+      if ( largeBlocks[i].size >= size
+           && (best == largeBlocks.size() || largeBlocks[i].size < largeBlocks[best].size) ) {
+        best = i;
+      }
+    }
+    if ( best == largeBlocks.size() ) {
+      // operator new[] returns memory aligned for any fundamental type
+      largeBlocks.push_back(LargeBlock{std::unique_ptr<char[]>(new char[size]), size});
+    }
+    std::swap(largeBlocks[best], largeBlocks[largeBlocksInUse]);
+    return largeBlocks[largeBlocksInUse++].data.get();
+  }
+
+private: // data
+  const size_t chunkSize;
+  std::vector<std::unique_ptr<char[]>> chunks;
+  size_t chunksInUse = 0;
+  size_t used;  // bytes used in the current chunk
+  std::vector<LargeBlock> largeBlocks;
+  size_t largeBlocksInUse = 0;
+};
+
+/**
+ * STL allocator allocating from an Arena (deallocation is a no-op, the
+ * memory is recovered when the arena is reset).
+ */
+template<class T>
+class ArenaAllocator
+{
+public: // types
+  typedef T value_type;
+
+public: // functions
+  explicit ArenaAllocator(Arena& _arena) : arena(&_arena) {}
+
+  template<class U>
+  ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.arena) {}
+
+  T* allocate(size_t n)
+  {
+    return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T*, size_t) {}
+
+  template<class U>
+  bool operator==(const ArenaAllocator<U>& other) const { return arena == other.arena; }
+
+  template<class U>
+  bool operator!=(const ArenaAllocator<U>& other) const { return arena != other.arena; }
+
+private: // data
+  template<class U> friend class ArenaAllocator;
+  Arena* arena;
+};
+
+#endif //_ZIM_TOOL_ARENA_H_
@@ -61,8 +61,17 @@ public: // types
   template<class F>
   Value getOrPut(const Key& key, F f)
   {
-    std::promise<Value> valuePromise;
     std::unique_lock<std::mutex> l(lock_);
+    {
+      // A hit doesn't need a promise (whose shared state is allocated)
+      const auto x = impl_.get(key);
+      if ( x.hit() ) {
+        const ValuePlaceholder value = x.value();
+        l.unlock();
+        return value.get();
+      }
+    }
+    std::promise<Value> valuePromise;
     const auto x = impl_.getOrPut(key, valuePromise.get_future().share());
     l.unlock();
     if ( x.miss() ) {
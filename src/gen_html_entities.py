@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+
+'''
+Generates html_entities.cpp (the table of the HTML named character references
+used by decodeHtmlEntities()) from the WHATWG list of named character
+references that comes with Python (html.entities.html5).
+
+The names are stored in a perfect hash table built with the "hash and
+displace" method: a name is first hashed (with seed 0) into a bucket, and
+the displacement of the bucket is the seed of the hash giving the slot of
+the name in the table. The hash function must match htmlEntityHash() in
+tools.cpp.
+
+Usage: gen_html_entities.py > html_entities.cpp
+'''
+
+import html.entities
+
+TABLE_SIZE = 2400
+BUCKET_COUNT = 1024
+
+
+def fnv1a(name, seed):
+    h = (2166136261 ^ seed) & 0xFFFFFFFF
+    for c in name.encode():
+        h ^= c
+        h = (h * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def c_string(s):
+    return '"' + ''.join('\\x%02X' % b for b in s.encode()) + '"'
+
+
+def main():
+    entities = {}  # name without ';' -> (value, can be used without ';')
+    for name, value in html.entities.html5.items():
+        if name.endswith(';'):
+            base = name[:-1]
+            entities[base] = (value, entities.get(base, (None, False))[1])
+        else:
+            entities[name] = (value, True)
+
+    buckets = [[] for _ in range(BUCKET_COUNT)]
+    for name in entities:
+        buckets[fnv1a(name, 0) % BUCKET_COUNT].append(name)
+
+    slots = [None] * TABLE_SIZE
+    displacements = [0] * BUCKET_COUNT
+    order = sorted(range(BUCKET_COUNT), key=lambda b: -len(buckets[b]))
+    for b in order:
+        names = buckets[b]
+        if not names:
+            continue
+        for d in range(1, 65536):
+            positions = [fnv1a(n, d) % TABLE_SIZE for n in names]
+            if len(set(positions)) == len(positions) \
+               and all(slots[p] is None for p in positions):
+                break
+        else:
+            raise RuntimeError('No displacement found for bucket %d' % b)
+        displacements[b] = d
+        for n, p in zip(names, positions):
+            slots[p] = n
+
+    print('// Generated by gen_html_entities.py. Do not edit.')
+    print()
+    print('const size_t HTML_ENTITY_MAX_NAME_LENGTH = %d;' % max(map(len, entities)))
+    print('const size_t HTML_ENTITY_MAX_LEGACY_NAME_LENGTH = %d;'
+          % max(len(n) for n, (v, legacy) in entities.items() if legacy))
+    print('const size_t HTML_ENTITY_TABLE_SIZE = %d;' % TABLE_SIZE)
+    print('const size_t HTML_ENTITY_BUCKET_COUNT = %d;' % BUCKET_COUNT)
+    print()
+    print('const uint16_t htmlEntityDisplacements[HTML_ENTITY_BUCKET_COUNT] = {')
+    for i in range(0, BUCKET_COUNT, 12):
+        print('  ' + ', '.join('%5d' % d for d in displacements[i:i+12]) + ',')
+    print('};')
+    print()
+    print('// name, value (UTF-8), whether the ";" may be omitted (legacy names)')
+    print('const HtmlEntity htmlEntityTable[HTML_ENTITY_TABLE_SIZE] = {')
+    for n in slots:
+        if n is None:
+            print('  { "", "", false },')
+        else:
+            value, legacy = entities[n]
+            print('  { "%s", %s, %s },' % (n, c_string(value), 'true' if legacy else 'false'))
+    print('};')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,2499 @@
+// Generated by gen_html_entities.py. Do not edit.
+
+const size_t HTML_ENTITY_MAX_NAME_LENGTH = 31;
+const size_t HTML_ENTITY_MAX_LEGACY_NAME_LENGTH = 6;
+const size_t HTML_ENTITY_TABLE_SIZE = 2400;
+const size_t HTML_ENTITY_BUCKET_COUNT = 1024;
+
+const uint16_t htmlEntityDisplacements[HTML_ENTITY_BUCKET_COUNT] = {
+      5,     1,    12,     4,    10,     1,    15,     7,     5,     4,     1,     1,
+      8,     3,     0,     1,     1,     1,     5,     1,    24,     2,     2,     1,
+      1,     3,     0,     2,     2,    11,     5,     1,     4,     1,     8,     1,
+      7,     2,     1,     2,     9,     1,    13,     1,     1,     6,     3,     1,
+      5,    27,     4,    10,     1,     2,    48,     8,     2,     2,     1,     1,
+      3,     2,    25,     5,    11,     2,     0,     1,     1,    69,    15,    11,
+      1,     1,     7,     4,     1,     1,     0,     2,     1,     1,     0,    24,
+      3,     9,     6,    37,     3,    18,     0,    18,    34,     5,     1,     4,
+      1,     3,     0,     1,     7,     1,     1,    10,    15,     9,     3,     3,
+      7,    17,     0,     1,     4,     0,     3,    11,     0,     2,     0,     6,
+      4,     2,     0,     7,     3,    16,     1,     3,     1,     1,    12,     9,
+      8,     1,     2,     3,     2,    10,     1,     2,     1,     5,     4,     2,
+      2,     6,     6,     1,     2,     5,    14,     3,     4,     0,     1,     1,
+      1,     3,     1,     7,     2,     2,    19,     5,     1,     2,     5,     5,
+      2,     1,     6,    16,     1,     6,     8,     0,     3,     2,     6,     1,
+      0,     1,     1,     1,     2,     4,     2,    46,     1,     4,     9,     1,
+     24,     1,     1,    65,     3,     1,     0,     3,     2,     0,     6,     2,
+      1,     0,    12,     4,     2,     3,     8,     2,     0,     1,     3,     1,
+      0,     1,     0,     2,     3,     6,     1,    10,     2,     2,     3,     6,
+     16,    10,     3,     3,     3,     0,     1,     3,     1,     2,     3,     1,
+      2,    10,     5,    25,     1,     1,     0,    11,     3,     4,     3,    13,
+     11,     3,     0,     2,     4,     2,     4,     2,     5,     3,     2,     3,
+      7,     3,     2,     8,     2,    15,     4,     2,     2,    77,     7,     4,
+     65,     4,     2,     1,     0,    71,     1,     0,     4,     2,     3,     4,
+      1,     1,     2,     1,     0,     1,     1,     8,     2,     2,    10,     8,
+      4,     1,     0,    13,     1,     2,     7,     8,     0,    43,     7,     2,
+      7,     6,    14,    14,     1,    12,     0,     2,     0,     1,     2,     1,
+      2,     1,     1,     1,     2,    25,     3,    18,   109,     5,    12,    36,
+     11,     1,     3,     8,     6,     2,    13,    11,    88,     3,     3,    28,
+     20,   112,     1,     2,     2,     4,     2,     0,     0,     9,     0,     0,
+      8,    70,     0,    12,     3,    19,    20,     1,     1,     2,     0,    17,
+      1,     7,     3,     2,     1,     1,    25,     0,    53,     4,     0,     0,
+      2,     2,     3,    68,     1,     3,     2,     7,     4,     9,     2,     4,
+      0,     8,     9,     2,    19,     6,    57,     1,     2,     4,     4,     2,
+      5,    84,     6,     2,     0,     0,    13,     0,     0,    26,     3,     3,
+      0,    10,     5,    27,    70,     3,     1,     6,    13,     3,     1,     5,
+      4,     1,     0,     3,    33,    25,     5,     5,     1,     4,    72,    17,
+      2,     1,     5,    18,     1,    12,     4,     0,    28,     2,     0,     1,
+     11,     4,    71,     7,     6,     0,    12,     4,     4,    77,     9,    80,
+     14,     0,     0,     1,     4,     1,     1,     0,     5,    11,     1,     2,
+      0,     0,    13,    12,     2,    23,     3,     5,    12,    11,     7,     3,
+      1,     0,     0,     1,     1,     1,     0,    11,     5,     1,     1,    12,
+     13,     5,     3,     0,     0,     0,     6,     4,     4,     0,     4,     5,
+      9,     1,     7,     8,    64,     5,    38,     4,     7,    10,    10,     5,
+      6,     0,     1,     6,     2,     1,     1,     1,    34,     1,     3,     4,
+      1,     0,     0,     1,     3,    73,     2,     4,    64,    12,     9,     4,
+    115,    10,     1,     1,     0,     1,     1,     3,     0,    10,     2,    10,
+      9,     1,     2,     9,     6,     5,     9,     3,     1,    13,     0,     2,
+     75,     5,     3,    23,     1,     3,     6,     0,     2,    11,     0,     5,
+     20,     0,     4,    17,     5,     2,    13,     2,     0,     0,     1,     3,
+      1,     3,     1,     7,    74,     0,     6,     8,    19,     2,     4,     1,
+     10,     1,     4,    20,     3,     3,     7,     1,     2,   131,     0,     0,
+      6,     0,    11,    16,     2,     9,     5,     1,     2,     3,     2,     0,
+     19,     0,     7,    78,    25,     4,     5,    69,    27,     9,     4,     2,
+     20,    18,     0,     1,     9,     3,     0,     3,     1,     5,    37,     8,
+     10,     2,   130,     8,     1,     6,    13,     3,     9,     0,    14,    13,
+      6,     0,     6,     7,    10,    76,     1,    44,     1,     2,     3,    22,
+      1,     0,     2,     3,    15,    51,    47,    25,     5,     1,     9,    62,
+     44,    17,    10,     5,     0,     0,     1,    39,     3,     6,     2,    30,
+      1,     0,     6,     1,     8,     3,     1,     0,     1,    85,    15,    73,
+     15,     2,     2,     0,    23,     2,     4,     3,     7,     0,     4,     3,
+     14,     0,    12,    18,     0,    17,    17,     7,     0,     0,     8,     7,
+      9,   110,     1,     3,    17,     2,     1,     4,   145,     2,   128,     5,
+     76,     1,    13,     6,     1,     9,     2,     2,     8,     0,     3,     0,
+      7,     0,     9,     5,     2,     0,     1,     7,     8,     3,     3,     3,
+     11,     2,     9,     4,   129,     2,     6,    80,    91,     6,    11,    15,
+      6,    18,    66,     4,    33,     2,   157,     3,     1,     0,     4,     9,
+      3,    51,     5,    20,     5,     1,    20,    32,    37,    10,     2,     3,
+     33,     9,     6,     1,     2,     0,     6,    74,     0,     4,    72,    12,
+     12,    64,     3,     1,     2,    13,    15,    10,    25,    19,     9,     5,
+      2,    87,     7,    38,     5,   128,     6,     2,     2,     0,     0,     8,
+     21,     2,     0,    14,     5,     3,    41,     6,     9,     3,    15,     5,
+      4,     0,     7,    92,     0,     0,    97,    14,    15,    11,     4,    70,
+      5,     6,     3,     6,     6,    25,     1,     1,     5,     5,    10,     3,
+      5,     3,     9,    14,     2,     5,    30,    36,     0,     0,     6,    70,
+      0,     4,     2,    24,     3,    10,     8,   140,     3,    23,    70,     8,
+      5,     5,     2,     0,    26,    48,    19,     0,     2,    64,     5,     0,
+      3,    65,     2,    10,    56,     8,     4,    10,     2,    19,    39,    63,
+      9,     5,    67,    31,     4,    25,    46,     5,     2,     7,    20,     9,
+      9,    10,   137,     4,     8,     0,    18,    11,    53,     2,    53,     0,
+      1,     0,    11,     3,     0,     0,    12,   112,     2,     5,     1,     0,
+     42,     3,     2,     0,    15,    28,    13,     2,     5,     0,    17,    11,
+      6,    17,     3,    51,     2,    29,    12,    14,     0,    31,    82,   143,
+     32,     4,    40,     6,    30,    59,     3,     4,     4,     1,     1,     2,
+      0,    11,    24,   171,     1,     2,     5,     0,     2,     0,     1,     1,
+     21,     0,     1,     6,
+};
+
+// name, value (UTF-8), whether the ";" may be omitted (legacy names)
+const HtmlEntity htmlEntityTable[HTML_ENTITY_TABLE_SIZE] = {
+  { "realpart", "\xE2\x84\x9C", false },
+  { "Sfr", "\xF0\x9D\x94\x96", false },
+  { "Xopf", "\xF0\x9D\x95\x8F", false },
+  { "EmptySmallSquare", "\xE2\x97\xBB", false },
+  { "", "", false },
+  { "iota", "\xCE\xB9", false },
+  { "", "", false },
+  { "", "", false },
+  { "Upsilon", "\xCE\xA5", false },
+  { "NotDoubleVerticalBar", "\xE2\x88\xA6", false },
+  { "", "", false },
+  { "pscr", "\xF0\x9D\x93\x85", false },
+  { "zfr", "\xF0\x9D\x94\xB7", false },
+  { "Odblac", "\xC5\x90", false },
+  { "TildeFullEqual", "\xE2\x89\x85", false },
+  { "colone", "\xE2\x89\x94", false },
+  { "emacr", "\xC4\x93", false },
+  { "Sqrt", "\xE2\x88\x9A", false },
+  { "Lt", "\xE2\x89\xAA", false },
+  { "profsurf", "\xE2\x8C\x93", false },
+  { "nvgt", "\x3E\xE2\x83\x92", false },
+  { "nwarrow", "\xE2\x86\x96", false },
+  { "commat", "\x40", false },
+  { "olcir", "\xE2\xA6\xBE", false },
+  { "Lcy", "\xD0\x9B", false },
+  { "homtht", "\xE2\x88\xBB", false },
+  { "range", "\xE2\xA6\xA5", false },
+  { "angst", "\xC3\x85", false },
+  { "rceil", "\xE2\x8C\x89", false },
+  { "Iscr", "\xE2\x84\x90", false },
+  { "Gcirc", "\xC4\x9C", false },
+  { "jcirc", "\xC4\xB5", false },
+  { "Star", "\xE2\x8B\x86", false },
+  { "", "", false },
+  { "", "", false },
+  { "Uuml", "\xC3\x9C", true },
+  { "Kopf", "\xF0\x9D\x95\x82", false },
+  { "Idot", "\xC4\xB0", false },
+  { "eqslantgtr", "\xE2\xAA\x96", false },
+  { "Efr", "\xF0\x9D\x94\x88", false },
+  { "", "", false },
+  { "olt", "\xE2\xA7\x80", false },
+  { "", "", false },
+  { "nLl", "\xE2\x8B\x98\xCC\xB8", false },
+  { "Diamond", "\xE2\x8B\x84", false },
+  { "Pi", "\xCE\xA0", false },
+  { "lbarr", "\xE2\xA4\x8C", false },
+  { "propto", "\xE2\x88\x9D", false },
+  { "Iukcy", "\xD0\x86", false },
+  { "angmsdac", "\xE2\xA6\xAA", false },
+  { "LeftTeeVector", "\xE2\xA5\x9A", false },
+  { "", "", false },
+  { "Qopf", "\xE2\x84\x9A", false },
+  { "capand", "\xE2\xA9\x84", false },
+  { "Abreve", "\xC4\x82", false },
+  { "succnsim", "\xE2\x8B\xA9", false },
+  { "rarrhk", "\xE2\x86\xAA", false },
+  { "bsim", "\xE2\x88\xBD", false },
+  { "Chi", "\xCE\xA7", false },
+  { "Zcy", "\xD0\x97", false },
+  { "kopf", "\xF0\x9D\x95\x9C", false },
+  { "ii", "\xE2\x85\x88", false },
+  { "minusb", "\xE2\x8A\x9F", false },
+  { "xotime", "\xE2\xA8\x82", false },
+  { "thicksim", "\xE2\x88\xBC", false },
+  { "", "", false },
+  { "NotLessTilde", "\xE2\x89\xB4", false },
+  { "Kfr", "\xF0\x9D\x94\x8E", false },
+  { "wp", "\xE2\x84\x98", false },
+  { "", "", false },
+  { "emptyv", "\xE2\x88\x85", false },
+  { "subrarr", "\xE2\xA5\xB9", false },
+  { "scy", "\xD1\x81", false },
+  { "supsub", "\xE2\xAB\x94", false },
+  { "CirclePlus", "\xE2\x8A\x95", false },
+  { "compfn", "\xE2\x88\x98", false },
+  { "pluscir", "\xE2\xA8\xA2", false },
+  { "ExponentialE", "\xE2\x85\x87", false },
+  { "bfr", "\xF0\x9D\x94\x9F", false },
+  { "SHcy", "\xD0\xA8", false },
+  { "LeftDownVectorBar", "\xE2\xA5\x99", false },
+  { "LeftUpTeeVector", "\xE2\xA5\xA0", false },
+  { "Oacute", "\xC3\x93", true },
+  { "scnsim", "\xE2\x8B\xA9", false },
+  { "DiacriticalDot", "\xCB\x99", false },
+  { "dwangle", "\xE2\xA6\xA6", false },
+  { "OverBracket", "\xE2\x8E\xB4", false },
+  { "suphsol", "\xE2\x9F\x89", false },
+  { "Lfr", "\xF0\x9D\x94\x8F", false },
+  { "varsupsetneqq", "\xE2\xAB\x8C\xEF\xB8\x80", false },
+  { "LeftVectorBar", "\xE2\xA5\x92", false },
+  { "ssetmn", "\xE2\x88\x96", false },
+  { "supdot", "\xE2\xAA\xBE", false },
+  { "angsph", "\xE2\x88\xA2", false },
+  { "", "", false },
+  { "", "", false },
+  { "longleftrightarrow", "\xE2\x9F\xB7", false },
+  { "boxhD", "\xE2\x95\xA5", false },
+  { "cscr", "\xF0\x9D\x92\xB8", false },
+  { "lcy", "\xD0\xBB", false },
+  { "", "", false },
+  { "lhard", "\xE2\x86\xBD", false },
+  { "Kcy", "\xD0\x9A", false },
+  { "iquest", "\xC2\xBF", true },
+  { "theta", "\xCE\xB8", false },
+  { "andv", "\xE2\xA9\x9A", false },
+  { "subseteqq", "\xE2\xAB\x85", false },
+  { "nVdash", "\xE2\x8A\xAE", false },
+  { "lesges", "\xE2\xAA\x93", false },
+  { "boxuL", "\xE2\x95\x9B", false },
+  { "ngt", "\xE2\x89\xAF", false },
+  { "rightarrow", "\xE2\x86\x92", false },
+  { "cudarrr", "\xE2\xA4\xB5", false },
+  { "rlarr", "\xE2\x87\x84", false },
+  { "Re", "\xE2\x84\x9C", false },
+  { "FilledSmallSquare", "\xE2\x97\xBC", false },
+  { "nvdash", "\xE2\x8A\xAC", false },
+  { "triangleleft", "\xE2\x97\x83", false },
+  { "", "", false },
+  { "", "", false },
+  { "gcirc", "\xC4\x9D", false },
+  { "lstrok", "\xC5\x82", false },
+  { "nge", "\xE2\x89\xB1", false },
+  { "gsiml", "\xE2\xAA\x90", false },
+  { "QUOT", "\x22", true },
+  { "LeftDoubleBracket", "\xE2\x9F\xA6", false },
+  { "HARDcy", "\xD0\xAA", false },
+  { "boxdr", "\xE2\x94\x8C", false },
+  { "", "", false },
+  { "alefsym", "\xE2\x84\xB5", false },
+  { "angrtvbd", "\xE2\xA6\x9D", false },
+  { "", "", false },
+  { "Dscr", "\xF0\x9D\x92\x9F", false },
+  { "sscr", "\xF0\x9D\x93\x88", false },
+  { "rbrke", "\xE2\xA6\x8C", false },
+  { "uwangle", "\xE2\xA6\xA7", false },
+  { "leftharpoonup", "\xE2\x86\xBC", false },
+  { "tint", "\xE2\x88\xAD", false },
+  { "CircleMinus", "\xE2\x8A\x96", false },
+  { "esdot", "\xE2\x89\x90", false },
+  { "rHar", "\xE2\xA5\xA4", false },
+  { "Jcirc", "\xC4\xB4", false },
+  { "searrow", "\xE2\x86\x98", false },
+  { "Ntilde", "\xC3\x91", true },
+  { "percnt", "\x25", false },
+  { "mcy", "\xD0\xBC", false },
+  { "Ccaron", "\xC4\x8C", false },
+  { "swarhk", "\xE2\xA4\xA6", false },
+  { "xvee", "\xE2\x8B\x81", false },
+  { "Ubrcy", "\xD0\x8E", false },
+  { "Lstrok", "\xC5\x81", false },
+  { "Bcy", "\xD0\x91", false },
+  { "block", "\xE2\x96\x88", false },
+  { "sqcaps", "\xE2\x8A\x93\xEF\xB8\x80", false },
+  { "nabla", "\xE2\x88\x87", false },
+  { "Subset", "\xE2\x8B\x90", false },
+  { "odot", "\xE2\x8A\x99", false },
+  { "precneqq", "\xE2\xAA\xB5", false },
+  { "DoubleDownArrow", "\xE2\x87\x93", false },
+  { "dHar", "\xE2\xA5\xA5", false },
+  { "exist", "\xE2\x88\x83", false },
+  { "ThickSpace", "\xE2\x81\x9F\xE2\x80\x8A", false },
+  { "loarr", "\xE2\x87\xBD", false },
+  { "", "", false },
+  { "gEl", "\xE2\xAA\x8C", false },
+  { "precnapprox", "\xE2\xAA\xB9", false },
+  { "NotSquareSuperset", "\xE2\x8A\x90\xCC\xB8", false },
+  { "GreaterSlantEqual", "\xE2\xA9\xBE", false },
+  { "Iogon", "\xC4\xAE", false },
+  { "", "", false },
+  { "VeryThinSpace", "\xE2\x80\x8A", false },
+  { "xfr", "\xF0\x9D\x94\xB5", false },
+  { "", "", false },
+  { "larr", "\xE2\x86\x90", false },
+  { "", "", false },
+  { "Iota", "\xCE\x99", false },
+  { "", "", false },
+  { "napos", "\xC5\x89", false },
+  { "Eopf", "\xF0\x9D\x94\xBC", false },
+  { "lbrke", "\xE2\xA6\x8B", false },
+  { "LeftAngleBracket", "\xE2\x9F\xA8", false },
+  { "ntgl", "\xE2\x89\xB9", false },
+  { "", "", false },
+  { "Uscr", "\xF0\x9D\x92\xB0", false },
+  { "Congruent", "\xE2\x89\xA1", false },
+  { "", "", false },
+  { "setminus", "\xE2\x88\x96", false },
+  { "Prime", "\xE2\x80\xB3", false },
+  { "LeftDownVector", "\xE2\x87\x83", false },
+  { "half", "\xC2\xBD", false },
+  { "thorn", "\xC3\xBE", true },
+  { "supedot", "\xE2\xAB\x84", false },
+  { "boxminus", "\xE2\x8A\x9F", false },
+  { "", "", false },
+  { "angmsdag", "\xE2\xA6\xAE", false },
+  { "gescc", "\xE2\xAA\xA9", false },
+  { "", "", false },
+  { "Assign", "\xE2\x89\x94", false },
+  { "ic", "\xE2\x81\xA3", false },
+  { "ratail", "\xE2\xA4\x9A", false },
+  { "apE", "\xE2\xA9\xB0", false },
+  { "Gcedil", "\xC4\xA2", false },
+  { "notinE", "\xE2\x8B\xB9\xCC\xB8", false },
+  { "sqcap", "\xE2\x8A\x93", false },
+  { "rpargt", "\xE2\xA6\x94", false },
+  { "mumap", "\xE2\x8A\xB8", false },
+  { "precnsim", "\xE2\x8B\xA8", false },
+  { "yucy", "\xD1\x8E", false },
+  { "nvltrie", "\xE2\x8A\xB4\xE2\x83\x92", false },
+  { "lBarr", "\xE2\xA4\x8E", false },
+  { "", "", false },
+  { "upharpoonright", "\xE2\x86\xBE", false },
+  { "odblac", "\xC5\x91", false },
+  { "plustwo", "\xE2\xA8\xA7", false },
+  { "icy", "\xD0\xB8", false },
+  { "varphi", "\xCF\x95", false },
+  { "ord", "\xE2\xA9\x9D", false },
+  { "oint", "\xE2\x88\xAE", false },
+  { "Pfr", "\xF0\x9D\x94\x93", false },
+  { "kscr", "\xF0\x9D\x93\x80", false },
+  { "", "", false },
+  { "DoubleUpArrow", "\xE2\x87\x91", false },
+  { "rationals", "\xE2\x84\x9A", false },
+  { "NewLine", "\x0A", false },
+  { "Dcy", "\xD0\x94", false },
+  { "Ccedil", "\xC3\x87", true },
+  { "sopf", "\xF0\x9D\x95\xA4", false },
+  { "PartialD", "\xE2\x88\x82", false },
+  { "gnap", "\xE2\xAA\x8A", false },
+  { "marker", "\xE2\x96\xAE", false },
+  { "larrhk", "\xE2\x86\xA9", false },
+  { "boxVH", "\xE2\x95\xAC", false },
+  { "bsol", "\x5C", false },
+  { "ntrianglelefteq", "\xE2\x8B\xAC", false },
+  { "DownTee", "\xE2\x8A\xA4", false },
+  { "", "", false },
+  { "NotSuperset", "\xE2\x8A\x83\xE2\x83\x92", false },
+  { "supmult", "\xE2\xAB\x82", false },
+  { "boxUr", "\xE2\x95\x99", false },
+  { "xhArr", "\xE2\x9F\xBA", false },
+  { "RightVector", "\xE2\x87\x80", false },
+  { "ltri", "\xE2\x97\x83", false },
+  { "", "", false },
+  { "Omicron", "\xCE\x9F", false },
+  { "wr", "\xE2\x89\x80", false },
+  { "Tcy", "\xD0\xA2", false },
+  { "horbar", "\xE2\x80\x95", false },
+  { "nwArr", "\xE2\x87\x96", false },
+  { "LeftTriangleEqual", "\xE2\x8A\xB4", false },
+  { "GreaterEqual", "\xE2\x89\xA5", false },
+  { "", "", false },
+  { "eDDot", "\xE2\xA9\xB7", false },
+  { "leftthreetimes", "\xE2\x8B\x8B", false },
+  { "simgE", "\xE2\xAA\xA0", false },
+  { "LeftFloor", "\xE2\x8C\x8A", false },
+  { "ContourIntegral", "\xE2\x88\xAE", false },
+  { "Jscr", "\xF0\x9D\x92\xA5", false },
+  { "nsqsube", "\xE2\x8B\xA2", false },
+  { "", "", false },
+  { "sigmaf", "\xCF\x82", false },
+  { "qprime", "\xE2\x81\x97", false },
+  { "sstarf", "\xE2\x8B\x86", false },
+  { "dagger", "\xE2\x80\xA0", false },
+  { "phiv", "\xCF\x95", false },
+  { "Supset", "\xE2\x8B\x91", false },
+  { "Proportional", "\xE2\x88\x9D", false },
+  { "sigma", "\xCF\x83", false },
+  { "NotLeftTriangleEqual", "\xE2\x8B\xAC", false },
+  { "rharul", "\xE2\xA5\xAC", false },
+  { "prcue", "\xE2\x89\xBC", false },
+  { "thickapprox", "\xE2\x89\x88", false },
+  { "subplus", "\xE2\xAA\xBF", false },
+  { "smtes", "\xE2\xAA\xAC\xEF\xB8\x80", false },
+  { "", "", false },
+  { "varpi", "\xCF\x96", false },
+  { "Darr", "\xE2\x86\xA1", false },
+  { "softcy", "\xD1\x8C", false },
+  { "abreve", "\xC4\x83", false },
+  { "ltquest", "\xE2\xA9\xBB", false },
+  { "intcal", "\xE2\x8A\xBA", false },
+  { "", "", false },
+  { "oplus", "\xE2\x8A\x95", false },
+  { "zcaron", "\xC5\xBE", false },
+  { "Sc", "\xE2\xAA\xBC", false },
+  { "acd", "\xE2\x88\xBF", false },
+  { "", "", false },
+  { "simne", "\xE2\x89\x86", false },
+  { "rdquo", "\xE2\x80\x9D", false },
+  { "frac34", "\xC2\xBE", true },
+  { "tstrok", "\xC5\xA7", false },
+  { "Coproduct", "\xE2\x88\x90", false },
+  { "Icirc", "\xC3\x8E", true },
+  { "", "", false },
+  { "gt", "\x3E", true },
+  { "tilde", "\xCB\x9C", false },
+  { "SquareIntersection", "\xE2\x8A\x93", false },
+  { "cularrp", "\xE2\xA4\xBD", false },
+  { "lnap", "\xE2\xAA\x89", false },
+  { "prime", "\xE2\x80\xB2", false },
+  { "NotPrecedes", "\xE2\x8A\x80", false },
+  { "Implies", "\xE2\x87\x92", false },
+  { "Vert", "\xE2\x80\x96", false },
+  { "DownLeftTeeVector", "\xE2\xA5\x9E", false },
+  { "LeftTee", "\xE2\x8A\xA3", false },
+  { "", "", false },
+  { "top", "\xE2\x8A\xA4", false },
+  { "Ecy", "\xD0\xAD", false },
+  { "jfr", "\xF0\x9D\x94\xA7", false },
+  { "", "", false },
+  { "dotsquare", "\xE2\x8A\xA1", false },
+  { "thinsp", "\xE2\x80\x89", false },
+  { "ang", "\xE2\x88\xA0", false },
+  { "barwedge", "\xE2\x8C\x85", false },
+  { "boxvH", "\xE2\x95\xAA", false },
+  { "cdot", "\xC4\x8B", false },
+  { "fjlig", "\x66\x6A", false },
+  { "Emacr", "\xC4\x92", false },
+  { "", "", false },
+  { "Aopf", "\xF0\x9D\x94\xB8", false },
+  { "rsaquo", "\xE2\x80\xBA", false },
+  { "", "", false },
+  { "nsim", "\xE2\x89\x81", false },
+  { "GreaterFullEqual", "\xE2\x89\xA7", false },
+  { "lsh", "\xE2\x86\xB0", false },
+  { "ccirc", "\xC4\x89", false },
+  { "yacute", "\xC3\xBD", true },
+  { "REG", "\xC2\xAE", true },
+  { "RightUpDownVector", "\xE2\xA5\x8F", false },
+  { "deg", "\xC2\xB0", true },
+  { "UpArrowBar", "\xE2\xA4\x92", false },
+  { "SquareSubset", "\xE2\x8A\x8F", false },
+  { "RightTriangleBar", "\xE2\xA7\x90", false },
+  { "odiv", "\xE2\xA8\xB8", false },
+  { "", "", false },
+  { "LeftTriangle", "\xE2\x8A\xB2", false },
+  { "NJcy", "\xD0\x8A", false },
+  { "grave", "\x60", false },
+  { "pointint", "\xE2\xA8\x95", false },
+  { "", "", false },
+  { "nsupset", "\xE2\x8A\x83\xE2\x83\x92", false },
+  { "sqsubseteq", "\xE2\x8A\x91", false },
+  { "RightUpTeeVector", "\xE2\xA5\x9C", false },
+  { "RightArrowBar", "\xE2\x87\xA5", false },
+  { "utilde", "\xC5\xA9", false },
+  { "ntilde", "\xC3\xB1", true },
+  { "", "", false },
+  { "Fcy", "\xD0\xA4", false },
+  { "apos", "\x27", false },
+  { "phone", "\xE2\x98\x8E", false },
+  { "ulcorner", "\xE2\x8C\x9C", false },
+  { "gtrarr", "\xE2\xA5\xB8", false },
+  { "Eogon", "\xC4\x98", false },
+  { "acute", "\xC2\xB4", true },
+  { "nparallel", "\xE2\x88\xA6", false },
+  { "", "", false },
+  { "", "", false },
+  { "oacute", "\xC3\xB3", true },
+  { "osol", "\xE2\x8A\x98", false },
+  { "", "", false },
+  { "", "", false },
+  { "ShortUpArrow", "\xE2\x86\x91", false },
+  { "cirscir", "\xE2\xA7\x82", false },
+  { "NotTildeEqual", "\xE2\x89\x84", false },
+  { "nvDash", "\xE2\x8A\xAD", false },
+  { "semi", "\x3B", false },
+  { "prnE", "\xE2\xAA\xB5", false },
+  { "Omega", "\xCE\xA9", false },
+  { "macr", "\xC2\xAF", true },
+  { "", "", false },
+  { "SmallCircle", "\xE2\x88\x98", false },
+  { "delta", "\xCE\xB4", false },
+  { "DiacriticalAcute", "\xC2\xB4", false },
+  { "Alpha", "\xCE\x91", false },
+  { "heartsuit", "\xE2\x99\xA5", false },
+  { "", "", false },
+  { "cupdot", "\xE2\x8A\x8D", false },
+  { "OverParenthesis", "\xE2\x8F\x9C", false },
+  { "Sopf", "\xF0\x9D\x95\x8A", false },
+  { "els", "\xE2\xAA\x95", false },
+  { "nGt", "\xE2\x89\xAB\xE2\x83\x92", false },
+  { "ubreve", "\xC5\xAD", false },
+  { "Superset", "\xE2\x8A\x83", false },
+  { "mstpos", "\xE2\x88\xBE", false },
+  { "ouml", "\xC3\xB6", true },
+  { "cup", "\xE2\x88\xAA", false },
+  { "", "", false },
+  { "bumpeq", "\xE2\x89\x8F", false },
+  { "khcy", "\xD1\x85", false },
+  { "beta", "\xCE\xB2", false },
+  { "Yacute", "\xC3\x9D", true },
+  { "scedil", "\xC5\x9F", false },
+  { "subseteq", "\xE2\x8A\x86", false },
+  { "nvge", "\xE2\x89\xA5\xE2\x83\x92", false },
+  { "gvertneqq", "\xE2\x89\xA9\xEF\xB8\x80", false },
+  { "nvap", "\xE2\x89\x8D\xE2\x83\x92", false },
+  { "ange", "\xE2\xA6\xA4", false },
+  { "supe", "\xE2\x8A\x87", false },
+  { "Larr", "\xE2\x86\x9E", false },
+  { "NotLess", "\xE2\x89\xAE", false },
+  { "escr", "\xE2\x84\xAF", false },
+  { "Mscr", "\xE2\x84\xB3", false },
+  { "suphsub", "\xE2\xAB\x97", false },
+  { "ncup", "\xE2\xA9\x82", false },
+  { "Fscr", "\xE2\x84\xB1", false },
+  { "", "", false },
+  { "", "", false },
+  { "sqcups", "\xE2\x8A\x94\xEF\xB8\x80", false },
+  { "GT", "\x3E", true },
+  { "scaron", "\xC5\xA1", false },
+  { "MediumSpace", "\xE2\x81\x9F", false },
+  { "nGg", "\xE2\x8B\x99\xCC\xB8", false },
+  { "nshortparallel", "\xE2\x88\xA6", false },
+  { "Lscr", "\xE2\x84\x92", false },
+  { "lE", "\xE2\x89\xA6", false },
+  { "", "", false },
+  { "", "", false },
+  { "imath", "\xC4\xB1", false },
+  { "NotGreaterTilde", "\xE2\x89\xB5", false },
+  { "OpenCurlyDoubleQuote", "\xE2\x80\x9C", false },
+  { "laemptyv", "\xE2\xA6\xB4", false },
+  { "sfr", "\xF0\x9D\x94\xB0", false },
+  { "plankv", "\xE2\x84\x8F", false },
+  { "Pcy", "\xD0\x9F", false },
+  { "", "", false },
+  { "boxdl", "\xE2\x94\x90", false },
+  { "ShortRightArrow", "\xE2\x86\x92", false },
+  { "Pr", "\xE2\xAA\xBB", false },
+  { "crarr", "\xE2\x86\xB5", false },
+  { "Itilde", "\xC4\xA8", false },
+  { "trpezium", "\xE2\x8F\xA2", false },
+  { "ee", "\xE2\x85\x87", false },
+  { "gl", "\xE2\x89\xB7", false },
+  { "nharr", "\xE2\x86\xAE", false },
+  { "nsccue", "\xE2\x8B\xA1", false },
+  { "", "", false },
+  { "", "", false },
+  { "", "", false },
+  { "", "", false },
+  { "bigtriangleup", "\xE2\x96\xB3", false },
+  { "ETH", "\xC3\x90", true },
+  { "nang", "\xE2\x88\xA0\xE2\x83\x92", false },
+  { "xdtri", "\xE2\x96\xBD", false },
+  { "roplus", "\xE2\xA8\xAE", false },
+  { "lesseqgtr", "\xE2\x8B\x9A", false },
+  { "HilbertSpace", "\xE2\x84\x8B", false },
+  { "bemptyv", "\xE2\xA6\xB0", false },
+  { "varepsilon", "\xCF\xB5", false },
+  { "hfr", "\xF0\x9D\x94\xA5", false },
+  { "rmoustache", "\xE2\x8E\xB1", false },
+  { "", "", false },
+  { "Bumpeq", "\xE2\x89\x8E", false },
+  { "Yscr", "\xF0\x9D\x92\xB4", false },
+  { "nearrow", "\xE2\x86\x97", false },
+  { "wedge", "\xE2\x88\xA7", false },
+  { "Ufr", "\xF0\x9D\x94\x98", false },
+  { "backprime", "\xE2\x80\xB5", false },
+  { "SOFTcy", "\xD0\xAC", false },
+  { "circlearrowright", "\xE2\x86\xBB", false },
+  { "Zacute", "\xC5\xB9", false },
+  { "ordm", "\xC2\xBA", true },
+  { "DD", "\xE2\x85\x85", false },
+  { "NotExists", "\xE2\x88\x84", false },
+  { "NotSquareSupersetEqual", "\xE2\x8B\xA3", false },
+  { "Ycy", "\xD0\xAB", false },
+  { "mfr", "\xF0\x9D\x94\xAA", false },
+  { "", "", false },
+  { "Amacr", "\xC4\x80", false },
+  { "topf", "\xF0\x9D\x95\xA5", false },
+  { "scnE", "\xE2\xAA\xB6", false },
+  { "frown", "\xE2\x8C\xA2", false },
+  { "NotLessGreater", "\xE2\x89\xB8", false },
+  { "lneqq", "\xE2\x89\xA8", false },
+  { "tau", "\xCF\x84", false },
+  { "", "", false },
+  { "nsucc", "\xE2\x8A\x81", false },
+  { "becaus", "\xE2\x88\xB5", false },
+  { "RightDownTeeVector", "\xE2\xA5\x9D", false },
+  { "Scy", "\xD0\xA1", false },
+  { "lthree", "\xE2\x8B\x8B", false },
+  { "Element", "\xE2\x88\x88", false },
+  { "therefore", "\xE2\x88\xB4", false },
+  { "rBarr", "\xE2\xA4\x8F", false },
+  { "xrArr", "\xE2\x9F\xB9", false },
+  { "parsim", "\xE2\xAB\xB3", false },
+  { "cire", "\xE2\x89\x97", false },
+  { "prnap", "\xE2\xAA\xB9", false },
+  { "Bscr", "\xE2\x84\xAC", false },
+  { "aring", "\xC3\xA5", true },
+  { "lat", "\xE2\xAA\xAB", false },
+  { "copy", "\xC2\xA9", true },
+  { "longmapsto", "\xE2\x9F\xBC", false },
+  { "", "", false },
+  { "copf", "\xF0\x9D\x95\x94", false },
+  { "YUcy", "\xD0\xAE", false },
+  { "num", "\x23", false },
+  { "ddarr", "\xE2\x87\x8A", false },
+  { "agrave", "\xC3\xA0", true },
+  { "boxUL", "\xE2\x95\x9D", false },
+  { "lbrack", "\x5B", false },
+  { "NestedLessLess", "\xE2\x89\xAA", false },
+  { "lessgtr", "\xE2\x89\xB6", false },
+  { "nLt", "\xE2\x89\xAA\xE2\x83\x92", false },
+  { "frac15", "\xE2\x85\x95", false },
+  { "risingdotseq", "\xE2\x89\x93", false },
+  { "VerticalTilde", "\xE2\x89\x80", false },
+  { "niv", "\xE2\x88\x8B", false },
+  { "mapstoup", "\xE2\x86\xA5", false },
+  { "odash", "\xE2\x8A\x9D", false },
+  { "NegativeThickSpace", "\xE2\x80\x8B", false },
+  { "Uarr", "\xE2\x86\x9F", false },
+  { "sce", "\xE2\xAA\xB0", false },
+  { "ThinSpace", "\xE2\x80\x89", false },
+  { "Dagger", "\xE2\x80\xA1", false },
+  { "otimes", "\xE2\x8A\x97", false },
+  { "simrarr", "\xE2\xA5\xB2", false },
+  { "dopf", "\xF0\x9D\x95\x95", false },
+  { "tcaron", "\xC5\xA5", false },
+  { "umacr", "\xC5\xAB", false },
+  { "frac16", "\xE2\x85\x99", false },
+  { "loang", "\xE2\x9F\xAC", false },
+  { "NotGreaterFullEqual", "\xE2\x89\xA7\xCC\xB8", false },
+  { "frasl", "\xE2\x81\x84", false },
+  { "para", "\xC2\xB6", true },
+  { "Mfr", "\xF0\x9D\x94\x90", false },
+  { "", "", false },
+  { "npart", "\xE2\x88\x82\xCC\xB8", false },
+  { "Rarr", "\xE2\x86\xA0", false },
+  { "weierp", "\xE2\x84\x98", false },
+  { "gnE", "\xE2\x89\xA9", false },
+  { "DownBreve", "\xCC\x91", false },
+  { "DoubleRightTee", "\xE2\x8A\xA8", false },
+  { "subsetneq", "\xE2\x8A\x8A", false },
+  { "xnis", "\xE2\x8B\xBB", false },
+  { "nrarrw", "\xE2\x86\x9D\xCC\xB8", false },
+  { "gbreve", "\xC4\x9F", false },
+  { "hksearow", "\xE2\xA4\xA5", false },
+  { "iecy", "\xD0\xB5", false },
+  { "nisd", "\xE2\x8B\xBA", false },
+  { "setmn", "\xE2\x88\x96", false },
+  { "nleqq", "\xE2\x89\xA6\xCC\xB8", false },
+  { "Longleftarrow", "\xE2\x9F\xB8", false },
+  { "", "", false },
+  { "Colone", "\xE2\xA9\xB4", false },
+  { "jcy", "\xD0\xB9", false },
+  { "Aogon", "\xC4\x84", false },
+  { "", "", false },
+  { "", "", false },
+  { "geq", "\xE2\x89\xA5", false },
+  { "TSHcy", "\xD0\x8B", false },
+  { "and", "\xE2\x88\xA7", false },
+  { "CenterDot", "\xC2\xB7", false },
+  { "", "", false },
+  { "", "", false },
+  { "otimesas", "\xE2\xA8\xB6", false },
+  { "succapprox", "\xE2\xAA\xB8", false },
+  { "barvee", "\xE2\x8A\xBD", false },
+  { "bumpe", "\xE2\x89\x8F", false },
+  { "rightharpoondown", "\xE2\x87\x81", false },
+  { "", "", false },
+  { "hopf", "\xF0\x9D\x95\x99", false },
+  { "nleqslant", "\xE2\xA9\xBD\xCC\xB8", false },
+  { "lap", "\xE2\xAA\x85", false },
+  { "nis", "\xE2\x8B\xBC", false },
+  { "", "", false },
+  { "nsupseteq", "\xE2\x8A\x89", false },
+  { "bkarow", "\xE2\xA4\x8D", false },
+  { "rlm", "\xE2\x80\x8F", false },
+  { "rarrap", "\xE2\xA5\xB5", false },
+  { "", "", false },
+  { "Equilibrium", "\xE2\x87\x8C", false },
+  { "dscy", "\xD1\x95", false },
+  { "vcy", "\xD0\xB2", false },
+  { "ldquo", "\xE2\x80\x9C", false },
+  { "ohbar", "\xE2\xA6\xB5", false },
+  { "order", "\xE2\x84\xB4", false },
+  { "Scedil", "\xC5\x9E", false },
+  { "dzigrarr", "\xE2\x9F\xBF", false },
+  { "rarrb", "\xE2\x87\xA5", false },
+  { "rdldhar", "\xE2\xA5\xA9", false },
+  { "boxur", "\xE2\x94\x94", false },
+  { "imacr", "\xC4\xAB", false },
+  { "Qscr", "\xF0\x9D\x92\xAC", false },
+  { "LeftUpVectorBar", "\xE2\xA5\x98", false },
+  { "pm", "\xC2\xB1", false },
+  { "thksim", "\xE2\x88\xBC", false },
+  { "nle", "\xE2\x89\xB0", false },
+  { "divide", "\xC3\xB7", true },
+  { "Sup", "\xE2\x8B\x91", false },
+  { "", "", false },
+  { "infintie", "\xE2\xA7\x9D", false },
+  { "nfr", "\xF0\x9D\x94\xAB", false },
+  { "Mu", "\xCE\x9C", false },
+  { "lsqb", "\x5B", false },
+  { "LessTilde", "\xE2\x89\xB2", false },
+  { "boxDR", "\xE2\x95\x94", false },
+  { "csup", "\xE2\xAB\x90", false },
+  { "Tscr", "\xF0\x9D\x92\xAF", false },
+  { "Phi", "\xCE\xA6", false },
+  { "xcirc", "\xE2\x97\xAF", false },
+  { "comma", "\x2C", false },
+  { "dash", "\xE2\x80\x90", false },
+  { "profalar", "\xE2\x8C\xAE", false },
+  { "upuparrows", "\xE2\x87\x88", false },
+  { "", "", false },
+  { "", "", false },
+  { "Lcedil", "\xC4\xBB", false },
+  { "Vcy", "\xD0\x92", false },
+  { "vdash", "\xE2\x8A\xA2", false },
+  { "Therefore", "\xE2\x88\xB4", false },
+  { "sub", "\xE2\x8A\x82", false },
+  { "times", "\xC3\x97", true },
+  { "", "", false },
+  { "udblac", "\xC5\xB1", false },
+  { "boxVR", "\xE2\x95\xA0", false },
+  { "integers", "\xE2\x84\xA4", false },
+  { "origof", "\xE2\x8A\xB6", false },
+  { "parsl", "\xE2\xAB\xBD", false },
+  { "lcaron", "\xC4\xBE", false },
+  { "larrsim", "\xE2\xA5\xB3", false },
+  { "Ucy", "\xD0\xA3", false },
+  { "boxVL", "\xE2\x95\xA3", false },
+  { "boxtimes", "\xE2\x8A\xA0", false },
+  { "copysr", "\xE2\x84\x97", false },
+  { "", "", false },
+  { "pcy", "\xD0\xBF", false },
+  { "UnderBracket", "\xE2\x8E\xB5", false },
+  { "bigtriangledown", "\xE2\x96\xBD", false },
+  { "RightTeeVector", "\xE2\xA5\x9B", false },
+  { "Upsi", "\xCF\x92", false },
+  { "lmoustache", "\xE2\x8E\xB0", false },
+  { "ntrianglerighteq", "\xE2\x8B\xAD", false },
+  { "oast", "\xE2\x8A\x9B", false },
+  { "drbkarow", "\xE2\xA4\x90", false },
+  { "NotSquareSubset", "\xE2\x8A\x8F\xCC\xB8", false },
+  { "chi", "\xCF\x87", false },
+  { "wedbar", "\xE2\xA9\x9F", false },
+  { "KJcy", "\xD0\x8C", false },
+  { "Cayleys", "\xE2\x84\xAD", false },
+  { "Psi", "\xCE\xA8", false },
+  { "eopf", "\xF0\x9D\x95\x96", false },
+  { "uscr", "\xF0\x9D\x93\x8A", false },
+  { "timesbar", "\xE2\xA8\xB1", false },
+  { "numero", "\xE2\x84\x96", false },
+  { "hstrok", "\xC4\xA7", false },
+  { "lurdshar", "\xE2\xA5\x8A", false },
+  { "mp", "\xE2\x88\x93", false },
+  { "NotEqualTilde", "\xE2\x89\x82\xCC\xB8", false },
+  { "", "", false },
+  { "iacute", "\xC3\xAD", true },
+  { "xi", "\xCE\xBE", false },
+  { "LessSlantEqual", "\xE2\xA9\xBD", false },
+  { "darr", "\xE2\x86\x93", false },
+  { "", "", false },
+  { "lscr", "\xF0\x9D\x93\x81", false },
+  { "rArr", "\xE2\x87\x92", false },
+  { "", "", false },
+  { "fork", "\xE2\x8B\x94", false },
+  { "uArr", "\xE2\x87\x91", false },
+  { "ogon", "\xCB\x9B", false },
+  { "cwconint", "\xE2\x88\xB2", false },
+  { "latail", "\xE2\xA4\x99", false },
+  { "gsim", "\xE2\x89\xB3", false },
+  { "ldrushar", "\xE2\xA5\x8B", false },
+  { "", "", false },
+  { "ogt", "\xE2\xA7\x81", false },
+  { "Beta", "\xCE\x92", false },
+  { "", "", false },
+  { "Zscr", "\xF0\x9D\x92\xB5", false },
+  { "ll", "\xE2\x89\xAA", false },
+  { "Imacr", "\xC4\xAA", false },
+  { "sdotb", "\xE2\x8A\xA1", false },
+  { "boxVh", "\xE2\x95\xAB", false },
+  { "", "", false },
+  { "Zdot", "\xC5\xBB", false },
+  { "Ropf", "\xE2\x84\x9D", false },
+  { "subsetneqq", "\xE2\xAB\x8B", false },
+  { "NotHumpDownHump", "\xE2\x89\x8E\xCC\xB8", false },
+  { "", "", false },
+  { "succeq", "\xE2\xAA\xB0", false },
+  { "dashv", "\xE2\x8A\xA3", false },
+  { "boxvR", "\xE2\x95\x9E", false },
+  { "ntriangleright", "\xE2\x8B\xAB", false },
+  { "napprox", "\xE2\x89\x89", false },
+  { "complement", "\xE2\x88\x81", false },
+  { "varsubsetneqq", "\xE2\xAB\x8B\xEF\xB8\x80", false },
+  { "Edot", "\xC4\x96", false },
+  { "bigotimes", "\xE2\xA8\x82", false },
+  { "Epsilon", "\xCE\x95", false },
+  { "smashp", "\xE2\xA8\xB3", false },
+  { "ape", "\xE2\x89\x8A", false },
+  { "Rcaron", "\xC5\x98", false },
+  { "Fopf", "\xF0\x9D\x94\xBD", false },
+  { "nrarrc", "\xE2\xA4\xB3\xCC\xB8", false },
+  { "", "", false },
+  { "nparsl", "\xE2\xAB\xBD\xE2\x83\xA5", false },
+  { "NotNestedLessLess", "\xE2\xAA\xA1\xCC\xB8", false },
+  { "", "", false },
+  { "", "", false },
+  { "nspar", "\xE2\x88\xA6", false },
+  { "nvle", "\xE2\x89\xA4\xE2\x83\x92", false },
+  { "rightleftharpoons", "\xE2\x87\x8C", false },
+  { "rtriltri", "\xE2\xA7\x8E", false },
+  { "Rfr", "\xE2\x84\x9C", false },
+  { "lt", "\x3C", true },
+  { "eng", "\xC5\x8B", false },
+  { "ufisht", "\xE2\xA5\xBE", false },
+  { "UpArrow", "\xE2\x86\x91", false },
+  { "", "", false },
+  { "", "", false },
+  { "Utilde", "\xC5\xA8", false },
+  { "downharpoonleft", "\xE2\x87\x83", false },
+  { "llarr", "\xE2\x87\x87", false },
+  { "ltcc", "\xE2\xAA\xA6", false },
+  { "Escr", "\xE2\x84\xB0", false },
+  { "longrightarrow", "\xE2\x9F\xB6", false },
+  { "image", "\xE2\x84\x91", false },
+  { "Omacr", "\xC5\x8C", false },
+  { "nrArr", "\xE2\x87\x8F", false },
+  { "quot", "\x22", true },
+  { "epsilon", "\xCE\xB5", false },
+  { "", "", false },
+  { "race", "\xE2\x88\xBD\xCC\xB1", false },
+  { "Laplacetrf", "\xE2\x84\x92", false },
+  { "hyphen", "\xE2\x80\x90", false },
+  { "approxeq", "\xE2\x89\x8A", false },
+  { "uopf", "\xF0\x9D\x95\xA6", false },
+  { "rscr", "\xF0\x9D\x93\x87", false },
+  { "shortmid", "\xE2\x88\xA3", false },
+  { "in", "\xE2\x88\x88", false },
+  { "nsupe", "\xE2\x8A\x89", false },
+  { "gtcir", "\xE2\xA9\xBA", false },
+  { "frac78", "\xE2\x85\x9E", false },
+  { "tritime", "\xE2\xA8\xBB", false },
+  { "Hopf", "\xE2\x84\x8D", false },
+  { "csub", "\xE2\xAB\x8F", false },
+  { "", "", false },
+  { "supset", "\xE2\x8A\x83", false },
+  { "nrtri", "\xE2\x8B\xAB", false },
+  { "ucy", "\xD1\x83", false },
+  { "Conint", "\xE2\x88\xAF", false },
+  { "afr", "\xF0\x9D\x94\x9E", false },
+  { "", "", false },
+  { "Vdash", "\xE2\x8A\xA9", false },
+  { "laquo", "\xC2\xAB", true },
+  { "starf", "\xE2\x98\x85", false },
+  { "atilde", "\xC3\xA3", true },
+  { "", "", false },
+  { "Dot", "\xC2\xA8", false },
+  { "square", "\xE2\x96\xA1", false },
+  { "dtrif", "\xE2\x96\xBE", false },
+  { "boxuR", "\xE2\x95\x98", false },
+  { "ntriangleleft", "\xE2\x8B\xAA", false },
+  { "Hscr", "\xE2\x84\x8B", false },
+  { "shcy", "\xD1\x88", false },
+  { "forkv", "\xE2\xAB\x99", false },
+  { "sigmav", "\xCF\x82", false },
+  { "Hacek", "\xCB\x87", false },
+  { "Zfr", "\xE2\x84\xA8", false },
+  { "Yuml", "\xC5\xB8", false },
+  { "minusdu", "\xE2\xA8\xAA", false },
+  { "diams", "\xE2\x99\xA6", false },
+  { "Proportion", "\xE2\x88\xB7", false },
+  { "NotSquareSubsetEqual", "\xE2\x8B\xA2", false },
+  { "sc", "\xE2\x89\xBB", false },
+  { "", "", false },
+  { "wreath", "\xE2\x89\x80", false },
+  { "Or", "\xE2\xA9\x94", false },
+  { "isinE", "\xE2\x8B\xB9", false },
+  { "iiota", "\xE2\x84\xA9", false },
+  { "rtri", "\xE2\x96\xB9", false },
+  { "UpDownArrow", "\xE2\x86\x95", false },
+  { "udarr", "\xE2\x87\x85", false },
+  { "frac13", "\xE2\x85\x93", false },
+  { "lotimes", "\xE2\xA8\xB4", false },
+  { "Fouriertrf", "\xE2\x84\xB1", false },
+  { "planckh", "\xE2\x84\x8E", false },
+  { "", "", false },
+  { "Nacute", "\xC5\x83", false },
+  { "backsim", "\xE2\x88\xBD", false },
+  { "hybull", "\xE2\x81\x83", false },
+  { "hearts", "\xE2\x99\xA5", false },
+  { "Lmidot", "\xC4\xBF", false },
+  { "leftleftarrows", "\xE2\x87\x87", false },
+  { "approx", "\xE2\x89\x88", false },
+  { "", "", false },
+  { "par", "\xE2\x88\xA5", false },
+  { "smile", "\xE2\x8C\xA3", false },
+  { "supdsub", "\xE2\xAB\x98", false },
+  { "rpar", "\x29", false },
+  { "epar", "\xE2\x8B\x95", false },
+  { "jukcy", "\xD1\x94", false },
+  { "CircleTimes", "\xE2\x8A\x97", false },
+  { "lnE", "\xE2\x89\xA8", false },
+  { "lrarr", "\xE2\x87\x86", false },
+  { "", "", false },
+  { "rarrw", "\xE2\x86\x9D", false },
+  { "NotGreaterLess", "\xE2\x89\xB9", false },
+  { "leftarrowtail", "\xE2\x86\xA2", false },
+  { "asympeq", "\xE2\x89\x8D", false },
+  { "curvearrowleft", "\xE2\x86\xB6", false },
+  { "", "", false },
+  { "napid", "\xE2\x89\x8B\xCC\xB8", false },
+  { "nsce", "\xE2\xAA\xB0\xCC\xB8", false },
+  { "slarr", "\xE2\x86\x90", false },
+  { "IOcy", "\xD0\x81", false },
+  { "shchcy", "\xD1\x89", false },
+  { "npr", "\xE2\x8A\x80", false },
+  { "uarr", "\xE2\x86\x91", false },
+  { "ForAll", "\xE2\x88\x80", false },
+  { "angmsdae", "\xE2\xA6\xAC", false },
+  { "iopf", "\xF0\x9D\x95\x9A", false },
+  { "backepsilon", "\xCF\xB6", false },
+  { "infin", "\xE2\x88\x9E", false },
+  { "xscr", "\xF0\x9D\x93\x8D", false },
+  { "timesd", "\xE2\xA8\xB0", false },
+  { "", "", false },
+  { "kappa", "\xCE\xBA", false },
+  { "lfr", "\xF0\x9D\x94\xA9", false },
+  { "profline", "\xE2\x8C\x92", false },
+  { "lbrace", "\x7B", false },
+  { "lAtail", "\xE2\xA4\x9B", false },
+  { "Egrave", "\xC3\x88", true },
+  { "rAarr", "\xE2\x87\x9B", false },
+  { "", "", false },
+  { "", "", false },
+  { "zhcy", "\xD0\xB6", false },
+  { "excl", "\x21", false },
+  { "LongLeftRightArrow", "\xE2\x9F\xB7", false },
+  { "omacr", "\xC5\x8D", false },
+  { "LeftUpVector", "\xE2\x86\xBF", false },
+  { "curlyeqprec", "\xE2\x8B\x9E", false },
+  { "NotElement", "\xE2\x88\x89", false },
+  { "angmsdab", "\xE2\xA6\xA9", false },
+  { "because", "\xE2\x88\xB5", false },
+  { "NotGreaterEqual", "\xE2\x89\xB1", false },
+  { "dbkarow", "\xE2\xA4\x8F", false },
+  { "sfrown", "\xE2\x8C\xA2", false },
+  { "ratio", "\xE2\x88\xB6", false },
+  { "mapstodown", "\xE2\x86\xA7", false },
+  { "ne", "\xE2\x89\xA0", false },
+  { "igrave", "\xC3\xAC", true },
+  { "Bernoullis", "\xE2\x84\xAC", false },
+  { "boxbox", "\xE2\xA7\x89", false },
+  { "supsetneqq", "\xE2\xAB\x8C", false },
+  { "NotSupersetEqual", "\xE2\x8A\x89", false },
+  { "", "", false },
+  { "Scirc", "\xC5\x9C", false },
+  { "YAcy", "\xD0\xAF", false },
+  { "", "", false },
+  { "nacute", "\xC5\x84", false },
+  { "lrhard", "\xE2\xA5\xAD", false },
+  { "notniva", "\xE2\x88\x8C", false },
+  { "", "", false },
+  { "comp", "\xE2\x88\x81", false },
+  { "CHcy", "\xD0\xA7", false },
+  { "dfr", "\xF0\x9D\x94\xA1", false },
+  { "Nu", "\xCE\x9D", false },
+  { "succcurlyeq", "\xE2\x89\xBD", false },
+  { "DDotrahd", "\xE2\xA4\x91", false },
+  { "hArr", "\xE2\x87\x94", false },
+  { "InvisibleTimes", "\xE2\x81\xA2", false },
+  { "", "", false },
+  { "gdot", "\xC4\xA1", false },
+  { "larrlp", "\xE2\x86\xAB", false },
+  { "leftrightarrows", "\xE2\x87\x86", false },
+  { "lesssim", "\xE2\x89\xB2", false },
+  { "ImaginaryI", "\xE2\x85\x88", false },
+  { "iiint", "\xE2\x88\xAD", false },
+  { "updownarrow", "\xE2\x86\x95", false },
+  { "bdquo", "\xE2\x80\x9E", false },
+  { "Ll", "\xE2\x8B\x98", false },
+  { "prec", "\xE2\x89\xBA", false },
+  { "HumpEqual", "\xE2\x89\x8F", false },
+  { "Cconint", "\xE2\x88\xB0", false },
+  { "urcorn", "\xE2\x8C\x9D", false },
+  { "TRADE", "\xE2\x84\xA2", false },
+  { "ofcir", "\xE2\xA6\xBF", false },
+  { "wedgeq", "\xE2\x89\x99", false },
+  { "ddotseq", "\xE2\xA9\xB7", false },
+  { "blk12", "\xE2\x96\x92", false },
+  { "aelig", "\xC3\xA6", true },
+  { "", "", false },
+  { "gvnE", "\xE2\x89\xA9\xEF\xB8\x80", false },
+  { "", "", false },
+  { "", "", false },
+  { "planck", "\xE2\x84\x8F", false },
+  { "mDDot", "\xE2\x88\xBA", false },
+  { "supE", "\xE2\xAB\x86", false },
+  { "yen", "\xC2\xA5", true },
+  { "rfr", "\xF0\x9D\x94\xAF", false },
+  { "eogon", "\xC4\x99", false },
+  { "ruluhar", "\xE2\xA5\xA8", false },
+  { "lhblk", "\xE2\x96\x84", false },
+  { "cupor", "\xE2\xA9\x85", false },
+  { "nsucceq", "\xE2\xAA\xB0\xCC\xB8", false },
+  { "zscr", "\xF0\x9D\x93\x8F", false },
+  { "tbrk", "\xE2\x8E\xB4", false },
+  { "Succeeds", "\xE2\x89\xBB", false },
+  { "rarrbfs", "\xE2\xA4\xA0", false },
+  { "boxHD", "\xE2\x95\xA6", false },
+  { "minusd", "\xE2\x88\xB8", false },
+  { "And", "\xE2\xA9\x93", false },
+  { "gnapprox", "\xE2\xAA\x8A", false },
+  { "bnequiv", "\xE2\x89\xA1\xE2\x83\xA5", false },
+  { "Gamma", "\xCE\x93", false },
+  { "sacute", "\xC5\x9B", false },
+  { "sdot", "\xE2\x8B\x85", false },
+  { "", "", false },
+  { "PlusMinus", "\xC2\xB1", false },
+  { "target", "\xE2\x8C\x96", false },
+  { "", "", false },
+  { "colon", "\x3A", false },
+  { "GreaterLess", "\xE2\x89\xB7", false },
+  { "llhard", "\xE2\xA5\xAB", false },
+  { "plusb", "\xE2\x8A\x9E", false },
+  { "SubsetEqual", "\xE2\x8A\x86", false },
+  { "ngtr", "\xE2\x89\xAF", false },
+  { "zdot", "\xC5\xBC", false },
+  { "lowbar", "\x5F", false },
+  { "vBar", "\xE2\xAB\xA8", false },
+  { "npreceq", "\xE2\xAA\xAF\xCC\xB8", false },
+  { "easter", "\xE2\xA9\xAE", false },
+  { "ReverseEquilibrium", "\xE2\x87\x8B", false },
+  { "Hat", "\x5E", false },
+  { "Agrave", "\xC3\x80", true },
+  { "", "", false },
+  { "dlcrop", "\xE2\x8C\x8D", false },
+  { "ofr", "\xF0\x9D\x94\xAC", false },
+  { "digamma", "\xCF\x9D", false },
+  { "", "", false },
+  { "UnderParenthesis", "\xE2\x8F\x9D", false },
+  { "nleq", "\xE2\x89\xB0", false },
+  { "eg", "\xE2\xAA\x9A", false },
+  { "vrtri", "\xE2\x8A\xB3", false },
+  { "sqsubset", "\xE2\x8A\x8F", false },
+  { "elsdot", "\xE2\xAA\x97", false },
+  { "ocirc", "\xC3\xB4", true },
+  { "prap", "\xE2\xAA\xB7", false },
+  { "uplus", "\xE2\x8A\x8E", false },
+  { "lmoust", "\xE2\x8E\xB0", false },
+  { "raemptyv", "\xE2\xA6\xB3", false },
+  { "rhov", "\xCF\xB1", false },
+  { "TScy", "\xD0\xA6", false },
+  { "TildeTilde", "\xE2\x89\x88", false },
+  { "cuvee", "\xE2\x8B\x8E", false },
+  { "orslope", "\xE2\xA9\x97", false },
+  { "angmsdad", "\xE2\xA6\xAB", false },
+  { "capdot", "\xE2\xA9\x80", false },
+  { "questeq", "\xE2\x89\x9F", false },
+  { "rsquor", "\xE2\x80\x99", false },
+  { "NotSucceedsTilde", "\xE2\x89\xBF\xCC\xB8", false },
+  { "ccaps", "\xE2\xA9\x8D", false },
+  { "ccedil", "\xC3\xA7", true },
+  { "", "", false },
+  { "DoubleLeftArrow", "\xE2\x87\x90", false },
+  { "neArr", "\xE2\x87\x97", false },
+  { "real", "\xE2\x84\x9C", false },
+  { "quest", "\x3F", false },
+  { "Racute", "\xC5\x94", false },
+  { "dcaron", "\xC4\x8F", false },
+  { "", "", false },
+  { "angmsd", "\xE2\x88\xA1", false },
+  { "", "", false },
+  { "Dopf", "\xF0\x9D\x94\xBB", false },
+  { "utri", "\xE2\x96\xB5", false },
+  { "boxDL", "\xE2\x95\x97", false },
+  { "bbrktbrk", "\xE2\x8E\xB6", false },
+  { "ssmile", "\xE2\x8C\xA3", false },
+  { "UnderBar", "\x5F", false },
+  { "larrtl", "\xE2\x86\xA2", false },
+  { "NotCupCap", "\xE2\x89\xAD", false },
+  { "straightphi", "\xCF\x95", false },
+  { "yicy", "\xD1\x97", false },
+  { "CapitalDifferentialD", "\xE2\x85\x85", false },
+  { "cylcty", "\xE2\x8C\xAD", false },
+  { "dotplus", "\xE2\x88\x94", false },
+  { "vfr", "\xF0\x9D\x94\xB3", false },
+  { "ijlig", "\xC4\xB3", false },
+  { "Otilde", "\xC3\x95", true },
+  { "coprod", "\xE2\x88\x90", false },
+  { "cedil", "\xC2\xB8", true },
+  { "gtcc", "\xE2\xAA\xA7", false },
+  { "nvlArr", "\xE2\xA4\x82", false },
+  { "gesl", "\xE2\x8B\x9B\xEF\xB8\x80", false },
+  { "wscr", "\xF0\x9D\x93\x8C", false },
+  { "roang", "\xE2\x9F\xAD", false },
+  { "shy", "\xC2\xAD", true },
+  { "piv", "\xCF\x96", false },
+  { "LeftArrow", "\xE2\x86\x90", false },
+  { "plusdo", "\xE2\x88\x94", false },
+  { "Xscr", "\xF0\x9D\x92\xB3", false },
+  { "", "", false },
+  { "", "", false },
+  { "Rarrtl", "\xE2\xA4\x96", false },
+  { "", "", false },
+  { "RuleDelayed", "\xE2\xA7\xB4", false },
+  { "xutri", "\xE2\x96\xB3", false },
+  { "loplus", "\xE2\xA8\xAD", false },
+  { "nesim", "\xE2\x89\x82\xCC\xB8", false },
+  { "Barwed", "\xE2\x8C\x86", false },
+  { "supne", "\xE2\x8A\x8B", false },
+  { "trianglelefteq", "\xE2\x8A\xB4", false },
+  { "ulcorn", "\xE2\x8C\x9C", false },
+  { "xsqcup", "\xE2\xA8\x86", false },
+  { "szlig", "\xC3\x9F", true },
+  { "Jopf", "\xF0\x9D\x95\x81", false },
+  { "Jukcy", "\xD0\x84", false },
+  { "rotimes", "\xE2\xA8\xB5", false },
+  { "ultri", "\xE2\x97\xB8", false },
+  { "NotRightTriangleEqual", "\xE2\x8B\xAD", false },
+  { "NotSubsetEqual", "\xE2\x8A\x88", false },
+  { "veeeq", "\xE2\x89\x9A", false },
+  { "Ccirc", "\xC4\x88", false },
+  { "", "", false },
+  { "conint", "\xE2\x88\xAE", false },
+  { "", "", false },
+  { "telrec", "\xE2\x8C\x95", false },
+  { "ap", "\xE2\x89\x88", false },
+  { "nbump", "\xE2\x89\x8E\xCC\xB8", false },
+  { "looparrowleft", "\xE2\x86\xAB", false },
+  { "simg", "\xE2\xAA\x9E", false },
+  { "UpArrowDownArrow", "\xE2\x87\x85", false },
+  { "", "", false },
+  { "nrarr", "\xE2\x86\x9B", false },
+  { "harr", "\xE2\x86\x94", false },
+  { "preccurlyeq", "\xE2\x89\xBC", false },
+  { "fallingdotseq", "\xE2\x89\x92", false },
+  { "Ascr", "\xF0\x9D\x92\x9C", false },
+  { "eqvparsl", "\xE2\xA7\xA5", false },
+  { "vzigzag", "\xE2\xA6\x9A", false },
+  { "LeftRightArrow", "\xE2\x86\x94", false },
+  { "there4", "\xE2\x88\xB4", false },
+  { "CloseCurlyDoubleQuote", "\xE2\x80\x9D", false },
+  { "raquo", "\xC2\xBB", true },
+  { "Dashv", "\xE2\xAB\xA4", false },
+  { "eqcolon", "\xE2\x89\x95", false },
+  { "angrt", "\xE2\x88\x9F", false },
+  { "boxhu", "\xE2\x94\xB4", false },
+  { "", "", false },
+  { "reals", "\xE2\x84\x9D", false },
+  { "", "", false },
+  { "", "", false },
+  { "leqq", "\xE2\x89\xA6", false },
+  { "", "", false },
+  { "", "", false },
+  { "", "", false },
+  { "rangd", "\xE2\xA6\x92", false },
+  { "circledast", "\xE2\x8A\x9B", false },
+  { "harrw", "\xE2\x86\xAD", false },
+  { "bcong", "\xE2\x89\x8C", false },
+  { "thetav", "\xCF\x91", false },
+  { "RightAngleBracket", "\xE2\x9F\xA9", false },
+  { "ZHcy", "\xD0\x96", false },
+  { "dharl", "\xE2\x87\x83", false },
+  { "Kcedil", "\xC4\xB6", false },
+  { "curlyeqsucc", "\xE2\x8B\x9F", false },
+  { "aogon", "\xC4\x85", false },
+  { "clubs", "\xE2\x99\xA3", false },
+  { "biguplus", "\xE2\xA8\x84", false },
+  { "nrtrie", "\xE2\x8B\xAD", false },
+  { "bigcirc", "\xE2\x97\xAF", false },
+  { "rarrpl", "\xE2\xA5\x85", false },
+  { "", "", false },
+  { "divonx", "\xE2\x8B\x87", false },
+  { "Ecaron", "\xC4\x9A", false },
+  { "ddagger", "\xE2\x80\xA1", false },
+  { "breve", "\xCB\x98", false },
+  { "LT", "\x3C", true },
+  { "nltri", "\xE2\x8B\xAA", false },
+  { "ecaron", "\xC4\x9B", false },
+  { "succ", "\xE2\x89\xBB", false },
+  { "Euml", "\xC3\x8B", true },
+  { "Ucirc", "\xC3\x9B", true },
+  { "LJcy", "\xD0\x89", false },
+  { "", "", false },
+  { "tosa", "\xE2\xA4\xA9", false },
+  { "olcross", "\xE2\xA6\xBB", false },
+  { "", "", false },
+  { "lesseqqgtr", "\xE2\xAA\x8B", false },
+  { "subnE", "\xE2\xAB\x8B", false },
+  { "Uarrocir", "\xE2\xA5\x89", false },
+  { "", "", false },
+  { "Xfr", "\xF0\x9D\x94\x9B", false },
+  { "nprec", "\xE2\x8A\x80", false },
+  { "DoubleLongRightArrow", "\xE2\x9F\xB9", false },
+  { "sect", "\xC2\xA7", true },
+  { "racute", "\xC5\x95", false },
+  { "", "", false },
+  { "Popf", "\xE2\x84\x99", false },
+  { "nsqsupe", "\xE2\x8B\xA3", false },
+  { "ljcy", "\xD1\x99", false },
+  { "sup2", "\xC2\xB2", true },
+  { "DownLeftRightVector", "\xE2\xA5\x90", false },
+  { "NestedGreaterGreater", "\xE2\x89\xAB", false },
+  { "Cedilla", "\xC2\xB8", false },
+  { "rdquor", "\xE2\x80\x9D", false },
+  { "SquareSupersetEqual", "\xE2\x8A\x92", false },
+  { "Gbreve", "\xC4\x9E", false },
+  { "urtri", "\xE2\x97\xB9", false },
+  { "VerticalLine", "\x7C", false },
+  { "topbot", "\xE2\x8C\xB6", false },
+  { "radic", "\xE2\x88\x9A", false },
+  { "djcy", "\xD1\x92", false },
+  { "nu", "\xCE\xBD", false },
+  { "supplus", "\xE2\xAB\x80", false },
+  { "hercon", "\xE2\x8A\xB9", false },
+  { "nLeftarrow", "\xE2\x87\x8D", false },
+  { "rbbrk", "\xE2\x9D\xB3", false },
+  { "uuarr", "\xE2\x87\x88", false },
+  { "LowerRightArrow", "\xE2\x86\x98", false },
+  { "capbrcup", "\xE2\xA9\x89", false },
+  { "robrk", "\xE2\x9F\xA7", false },
+  { "", "", false },
+  { "lg", "\xE2\x89\xB6", false },
+  { "Topf", "\xF0\x9D\x95\x8B", false },
+  { "Iacute", "\xC3\x8D", true },
+  { "cross", "\xE2\x9C\x97", false },
+  { "aleph", "\xE2\x84\xB5", false },
+  { "Rcy", "\xD0\xA0", false },
+  { "tprime", "\xE2\x80\xB4", false },
+  { "gfr", "\xF0\x9D\x94\xA4", false },
+  { "hellip", "\xE2\x80\xA6", false },
+  { "realine", "\xE2\x84\x9B", false },
+  { "Vee", "\xE2\x8B\x81", false },
+  { "inodot", "\xC4\xB1", false },
+  { "bigwedge", "\xE2\x8B\x80", false },
+  { "napE", "\xE2\xA9\xB0\xCC\xB8", false },
+  { "rsqb", "\x5D", false },
+  { "xcup", "\xE2\x8B\x83", false },
+  { "RightDownVectorBar", "\xE2\xA5\x95", false },
+  { "Map", "\xE2\xA4\x85", false },
+  { "female", "\xE2\x99\x80", false },
+  { "prE", "\xE2\xAA\xB3", false },
+  { "DiacriticalDoubleAcute", "\xCB\x9D", false },
+  { "Theta", "\xCE\x98", false },
+  { "ugrave", "\xC3\xB9", true },
+  { "", "", false },
+  { "FilledVerySmallSquare", "\xE2\x96\xAA", false },
+  { "uparrow", "\xE2\x86\x91", false },
+  { "", "", false },
+  { "", "", false },
+  { "dfisht", "\xE2\xA5\xBF", false },
+  { "", "", false },
+  { "", "", false },
+  { "tridot", "\xE2\x97\xAC", false },
+  { "", "", false },
+  { "xlarr", "\xE2\x9F\xB5", false },
+  { "Rightarrow", "\xE2\x87\x92", false },
+  { "intprod", "\xE2\xA8\xBC", false },
+  { "sdote", "\xE2\xA9\xA6", false },
+  { "", "", false },
+  { "curvearrowright", "\xE2\x86\xB7", false },
+  { "sqsup", "\xE2\x8A\x90", false },
+  { "lsaquo", "\xE2\x80\xB9", false },
+  { "notnivc", "\xE2\x8B\xBD", false },
+  { "verbar", "\x7C", false },
+  { "Bopf", "\xF0\x9D\x94\xB9", false },
+  { "hardcy", "\xD1\x8A", false },
+  { "nsubseteq", "\xE2\x8A\x88", false },
+  { "langd", "\xE2\xA6\x91", false },
+  { "nbsp", "\xC2\xA0", true },
+  { "notin", "\xE2\x88\x89", false },
+  { "sube", "\xE2\x8A\x86", false },
+  { "fllig", "\xEF\xAC\x82", false },
+  { "mldr", "\xE2\x80\xA6", false },
+  { "ovbar", "\xE2\x8C\xBD", false },
+  { "vopf", "\xF0\x9D\x95\xA7", false },
+  { "", "", false },
+  { "vellip", "\xE2\x8B\xAE", false },
+  { "Eacute", "\xC3\x89", true },
+  { "gcy", "\xD0\xB3", false },
+  { "Vdashl", "\xE2\xAB\xA6", false },
+  { "fltns", "\xE2\x96\xB1", false },
+  { "ring", "\xCB\x9A", false },
+  { "gsime", "\xE2\xAA\x8E", false },
+  { "ufr", "\xF0\x9D\x94\xB2", false },
+  { "NotTildeFullEqual", "\xE2\x89\x87", false },
+  { "nsmid", "\xE2\x88\xA4", false },
+  { "bcy", "\xD0\xB1", false },
+  { "caret", "\xE2\x81\x81", false },
+  { "leqslant", "\xE2\xA9\xBD", false },
+  { "bernou", "\xE2\x84\xAC", false },
+  { "nhpar", "\xE2\xAB\xB2", false },
+  { "iff", "\xE2\x87\x94", false },
+  { "caron", "\xCB\x87", false },
+  { "sqcup", "\xE2\x8A\x94", false },
+  { "bigcap", "\xE2\x8B\x82", false },
+  { "rarr", "\xE2\x86\x92", false },
+  { "", "", false },
+  { "empty", "\xE2\x88\x85", false },
+  { "Leftarrow", "\xE2\x87\x90", false },
+  { "lang", "\xE2\x9F\xA8", false },
+  { "", "", false },
+  { "Ncaron", "\xC5\x87", false },
+  { "yacy", "\xD1\x8F", false },
+  { "imagpart", "\xE2\x84\x91", false },
+  { "int", "\xE2\x88\xAB", false },
+  { "nsubseteqq", "\xE2\xAB\x85\xCC\xB8", false },
+  { "", "", false },
+  { "bNot", "\xE2\xAB\xAD", false },
+  { "vsupnE", "\xE2\xAB\x8C\xEF\xB8\x80", false },
+  { "rarrfs", "\xE2\xA4\x9E", false },
+  { "sup1", "\xC2\xB9", true },
+  { "boxul", "\xE2\x94\x98", false },
+  { "preceq", "\xE2\xAA\xAF", false },
+  { "", "", false },
+  { "gtdot", "\xE2\x8B\x97", false },
+  { "", "", false },
+  { "xopf", "\xF0\x9D\x95\xA9", false },
+  { "bbrk", "\xE2\x8E\xB5", false },
+  { "sime", "\xE2\x89\x83", false },
+  { "eparsl", "\xE2\xA7\xA3", false },
+  { "gtquest", "\xE2\xA9\xBC", false },
+  { "ndash", "\xE2\x80\x93", false },
+  { "Ecirc", "\xC3\x8A", true },
+  { "NotSucceedsEqual", "\xE2\xAA\xB0\xCC\xB8", false },
+  { "operp", "\xE2\xA6\xB9", false },
+  { "vscr", "\xF0\x9D\x93\x8B", false },
+  { "Kscr", "\xF0\x9D\x92\xA6", false },
+  { "smte", "\xE2\xAA\xAC", false },
+  { "Uogon", "\xC5\xB2", false },
+  { "nlArr", "\xE2\x87\x8D", false },
+  { "rangle", "\xE2\x9F\xA9", false },
+  { "AMP", "\x26", true },
+  { "Nfr", "\xF0\x9D\x94\x91", false },
+  { "mapstoleft", "\xE2\x86\xA4", false },
+  { "NegativeVeryThinSpace", "\xE2\x80\x8B", false },
+  { "Im", "\xE2\x84\x91", false },
+  { "shortparallel", "\xE2\x88\xA5", false },
+  { "aacute", "\xC3\xA1", true },
+  { "leq", "\xE2\x89\xA4", false },
+  { "", "", false },
+  { "mnplus", "\xE2\x88\x93", false },
+  { "squf", "\xE2\x96\xAA", false },
+  { "solbar", "\xE2\x8C\xBF", false },
+  { "DoubleLeftRightArrow", "\xE2\x87\x94", false },
+  { "DownArrowUpArrow", "\xE2\x87\xB5", false },
+  { "Gt", "\xE2\x89\xAB", false },
+  { "vangrt", "\xE2\xA6\x9C", false },
+  { "uml", "\xC2\xA8", true },
+  { "bigstar", "\xE2\x98\x85", false },
+  { "Afr", "\xF0\x9D\x94\x84", false },
+  { "xcap", "\xE2\x8B\x82", false },
+  { "boxdR", "\xE2\x95\x92", false },
+  { "nRightarrow", "\xE2\x87\x8F", false },
+  { "orderof", "\xE2\x84\xB4", false },
+  { "cudarrl", "\xE2\xA4\xB8", false },
+  { "rbrkslu", "\xE2\xA6\x90", false },
+  { "rightsquigarrow", "\xE2\x86\x9D", false },
+  { "zwj", "\xE2\x80\x8D", false },
+  { "", "", false },
+  { "NotVerticalBar", "\xE2\x88\xA4", false },
+  { "uogon", "\xC5\xB3", false },
+  { "nsupE", "\xE2\xAB\x86\xCC\xB8", false },
+  { "wopf", "\xF0\x9D\x95\xA8", false },
+  { "nsupseteqq", "\xE2\xAB\x86\xCC\xB8", false },
+  { "frac35", "\xE2\x85\x97", false },
+  { "boxVr", "\xE2\x95\x9F", false },
+  { "Breve", "\xCB\x98", false },
+  { "lopar", "\xE2\xA6\x85", false },
+  { "hkswarow", "\xE2\xA4\xA6", false },
+  { "multimap", "\xE2\x8A\xB8", false },
+  { "trie", "\xE2\x89\x9C", false },
+  { "nmid", "\xE2\x88\xA4", false },
+  { "lopf", "\xF0\x9D\x95\x9D", false },
+  { "gtrdot", "\xE2\x8B\x97", false },
+  { "coloneq", "\xE2\x89\x94", false },
+  { "plusmn", "\xC2\xB1", true },
+  { "capcap", "\xE2\xA9\x8B", false },
+  { "cong", "\xE2\x89\x85", false },
+  { "InvisibleComma", "\xE2\x81\xA3", false },
+  { "upharpoonleft", "\xE2\x86\xBF", false },
+  { "", "", false },
+  { "", "", false },
+  { "lesdot", "\xE2\xA9\xBF", false },
+  { "pound", "\xC2\xA3", true },
+  { "Ycirc", "\xC5\xB6", false },
+  { "lsquo", "\xE2\x80\x98", false },
+  { "circeq", "\xE2\x89\x97", false },
+  { "Auml", "\xC3\x84", true },
+  { "CounterClockwiseContourIntegral", "\xE2\x88\xB3", false },
+  { "", "", false },
+  { "", "", false },
+  { "imof", "\xE2\x8A\xB7", false },
+  { "gneq", "\xE2\xAA\x88", false },
+  { "SHCHcy", "\xD0\xA9", false },
+  { "iiiint", "\xE2\xA8\x8C", false },
+  { "bigodot", "\xE2\xA8\x80", false },
+  { "prnsim", "\xE2\x8B\xA8", false },
+  { "Del", "\xE2\x88\x87", false },
+  { "diam", "\xE2\x8B\x84", false },
+  { "dot", "\xCB\x99", false },
+  { "natural", "\xE2\x99\xAE", false },
+  { "Zeta", "\xCE\x96", false },
+  { "kcedil", "\xC4\xB7", false },
+  { "curren", "\xC2\xA4", true },
+  { "ast", "\x2A", false },
+  { "rrarr", "\xE2\x87\x89", false },
+  { "DoubleLeftTee", "\xE2\xAB\xA4", false },
+  { "Cacute", "\xC4\x86", false },
+  { "NonBreakingSpace", "\xC2\xA0", false },
+  { "wcirc", "\xC5\xB5", false },
+  { "el", "\xE2\xAA\x99", false },
+  { "dscr", "\xF0\x9D\x92\xB9", false },
+  { "", "", false },
+  { "boxvh", "\xE2\x94\xBC", false },
+  { "precsim", "\xE2\x89\xBE", false },
+  { "RightTeeArrow", "\xE2\x86\xA6", false },
+  { "Ofr", "\xF0\x9D\x94\x92", false },
+  { "between", "\xE2\x89\xAC", false },
+  { "TildeEqual", "\xE2\x89\x83", false },
+  { "male", "\xE2\x99\x82", false },
+  { "acE", "\xE2\x88\xBE\xCC\xB3", false },
+  { "csube", "\xE2\xAB\x91", false },
+  { "Mellintrf", "\xE2\x84\xB3", false },
+  { "nprcue", "\xE2\x8B\xA0", false },
+  { "nsubset", "\xE2\x8A\x82\xE2\x83\x92", false },
+  { "Tcedil", "\xC5\xA2", false },
+  { "nges", "\xE2\xA9\xBE\xCC\xB8", false },
+  { "nless", "\xE2\x89\xAE", false },
+  { "nLtv", "\xE2\x89\xAA\xCC\xB8", false },
+  { "Oopf", "\xF0\x9D\x95\x86", false },
+  { "NotPrecedesEqual", "\xE2\xAA\xAF\xCC\xB8", false },
+  { "LeftDownTeeVector", "\xE2\xA5\xA1", false },
+  { "", "", false },
+  { "yscr", "\xF0\x9D\x93\x8E", false },
+  { "lesg", "\xE2\x8B\x9A\xEF\xB8\x80", false },
+  { "ncedil", "\xC5\x86", false },
+  { "Ffr", "\xF0\x9D\x94\x89", false },
+  { "nGtv", "\xE2\x89\xAB\xCC\xB8", false },
+  { "gne", "\xE2\xAA\x88", false },
+  { "Hcirc", "\xC4\xA4", false },
+  { "qopf", "\xF0\x9D\x95\xA2", false },
+  { "varsubsetneq", "\xE2\x8A\x8A\xEF\xB8\x80", false },
+  { "xoplus", "\xE2\xA8\x81", false },
+  { "gjcy", "\xD1\x93", false },
+  { "LeftArrowBar", "\xE2\x87\xA4", false },
+  { "bprime", "\xE2\x80\xB5", false },
+  { "LongLeftArrow", "\xE2\x9F\xB5", false },
+  { "gesles", "\xE2\xAA\x94", false },
+  { "rcy", "\xD1\x80", false },
+  { "", "", false },
+  { "swnwar", "\xE2\xA4\xAA", false },
+  { "egrave", "\xC3\xA8", true },
+  { "diamondsuit", "\xE2\x99\xA6", false },
+  { "circledR", "\xC2\xAE", false },
+  { "lcedil", "\xC4\xBC", false },
+  { "doteqdot", "\xE2\x89\x91", false },
+  { "DiacriticalTilde", "\xCB\x9C", false },
+  { "Gfr", "\xF0\x9D\x94\x8A", false },
+  { "rnmid", "\xE2\xAB\xAE", false },
+  { "eplus", "\xE2\xA9\xB1", false },
+  { "DiacriticalGrave", "\x60", false },
+  { "lambda", "\xCE\xBB", false },
+  { "Bfr", "\xF0\x9D\x94\x85", false },
+  { "geqq", "\xE2\x89\xA7", false },
+  { "zeetrf", "\xE2\x84\xA8", false },
+  { "nvrArr", "\xE2\xA4\x83", false },
+  { "rightthreetimes", "\xE2\x8B\x8C", false },
+  { "numsp", "\xE2\x80\x87", false },
+  { "mdash", "\xE2\x80\x94", false },
+  { "iinfin", "\xE2\xA7\x9C", false },
+  { "ngeqq", "\xE2\x89\xA7\xCC\xB8", false },
+  { "nles", "\xE2\xA9\xBD\xCC\xB8", false },
+  { "Ugrave", "\xC3\x99", true },
+  { "bsemi", "\xE2\x81\x8F", false },
+  { "", "", false },
+  { "triangledown", "\xE2\x96\xBF", false },
+  { "ecy", "\xD1\x8D", false },
+  { "it", "\xE2\x81\xA2", false },
+  { "bne", "\x3D\xE2\x83\xA5", false },
+  { "LeftUpDownVector", "\xE2\xA5\x91", false },
+  { "longleftarrow", "\xE2\x9F\xB5", false },
+  { "plusacir", "\xE2\xA8\xA3", false },
+  { "boxhU", "\xE2\x95\xA8", false },
+  { "NotGreater", "\xE2\x89\xAF", false },
+  { "elinters", "\xE2\x8F\xA7", false },
+  { "Sacute", "\xC5\x9A", false },
+  { "dtri", "\xE2\x96\xBF", false },
+  { "NotGreaterGreater", "\xE2\x89\xAB\xCC\xB8", false },
+  { "lfisht", "\xE2\xA5\xBC", false },
+  { "maltese", "\xE2\x9C\xA0", false },
+  { "ensp", "\xE2\x80\x82", false },
+  { "dd", "\xE2\x85\x86", false },
+  { "", "", false },
+  { "GJcy", "\xD0\x83", false },
+  { "Rcedil", "\xC5\x96", false },
+  { "RightUpVector", "\xE2\x86\xBE", false },
+  { "oror", "\xE2\xA9\x96", false },
+  { "SucceedsSlantEqual", "\xE2\x89\xBD", false },
+  { "VDash", "\xE2\x8A\xAB", false },
+  { "Tau", "\xCE\xA4", false },
+  { "topfork", "\xE2\xAB\x9A", false },
+  { "hcirc", "\xC4\xA5", false },
+  { "", "", false },
+  { "TripleDot", "\xE2\x83\x9B", false },
+  { "", "", false },
+  { "fflig", "\xEF\xAC\x80", false },
+  { "bigvee", "\xE2\x8B\x81", false },
+  { "varsupsetneq", "\xE2\x8A\x8B\xEF\xB8\x80", false },
+  { "Sscr", "\xF0\x9D\x92\xAE", false },
+  { "DoubleLongLeftArrow", "\xE2\x9F\xB8", false },
+  { "Cdot", "\xC4\x8A", false },
+  { "", "", false },
+  { "lrcorner", "\xE2\x8C\x9F", false },
+  { "nwarhk", "\xE2\xA4\xA3", false },
+  { "bsolb", "\xE2\xA7\x85", false },
+  { "tscr", "\xF0\x9D\x93\x89", false },
+  { "nlsim", "\xE2\x89\xB4", false },
+  { "Iopf", "\xF0\x9D\x95\x80", false },
+  { "", "", false },
+  { "ifr", "\xF0\x9D\x94\xA6", false },
+  { "ycy", "\xD1\x8B", false },
+  { "Gdot", "\xC4\xA0", false },
+  { "Otimes", "\xE2\xA8\xB7", false },
+  { "erarr", "\xE2\xA5\xB1", false },
+  { "varkappa", "\xCF\xB0", false },
+  { "PrecedesEqual", "\xE2\xAA\xAF", false },
+  { "Cup", "\xE2\x8B\x93", false },
+  { "hairsp", "\xE2\x80\x8A", false },
+  { "Yopf", "\xF0\x9D\x95\x90", false },
+  { "bumpE", "\xE2\xAA\xAE", false },
+  { "vBarv", "\xE2\xAB\xA9", false },
+  { "prurel", "\xE2\x8A\xB0", false },
+  { "gtreqless", "\xE2\x8B\x9B", false },
+  { "curlyvee", "\xE2\x8B\x8E", false },
+  { "scirc", "\xC5\x9D", false },
+  { "ell", "\xE2\x84\x93", false },
+  { "NotLeftTriangle", "\xE2\x8B\xAA", false },
+  { "LeftArrowRightArrow", "\xE2\x87\x86", false },
+  { "xrarr", "\xE2\x9F\xB6", false },
+  { "UpTeeArrow", "\xE2\x86\xA5", false },
+  { "larrfs", "\xE2\xA4\x9D", false },
+  { "apacir", "\xE2\xA9\xAF", false },
+  { "OpenCurlyQuote", "\xE2\x80\x98", false },
+  { "", "", false },
+  { "circlearrowleft", "\xE2\x86\xBA", false },
+  { "Vfr", "\xF0\x9D\x94\x99", false },
+  { "", "", false },
+  { "Uring", "\xC5\xAE", false },
+  { "twoheadrightarrow", "\xE2\x86\xA0", false },
+  { "dollar", "\x24", false },
+  { "curarr", "\xE2\x86\xB7", false },
+  { "HorizontalLine", "\xE2\x94\x80", false },
+  { "", "", false },
+  { "iexcl", "\xC2\xA1", true },
+  { "Sub", "\xE2\x8B\x90", false },
+  { "NotReverseElement", "\xE2\x88\x8C", false },
+  { "", "", false },
+  { "ecir", "\xE2\x89\x96", false },
+  { "", "", false },
+  { "le", "\xE2\x89\xA4", false },
+  { "gesdoto", "\xE2\xAA\x82", false },
+  { "Ncy", "\xD0\x9D", false },
+  { "ulcrop", "\xE2\x8C\x8F", false },
+  { "lsimg", "\xE2\xAA\x8F", false },
+  { "rtimes", "\xE2\x8B\x8A", false },
+  { "dstrok", "\xC4\x91", false },
+  { "rtrif", "\xE2\x96\xB8", false },
+  { "awint", "\xE2\xA8\x91", false },
+  { "", "", false },
+  { "", "", false },
+  { "LeftTeeArrow", "\xE2\x86\xA4", false },
+  { "nLeftrightarrow", "\xE2\x87\x8E", false },
+  { "af", "\xE2\x81\xA1", false },
+  { "lozf", "\xE2\xA7\xAB", false },
+  { "", "", false },
+  { "NegativeMediumSpace", "\xE2\x80\x8B", false },
+  { "brvbar", "\xC2\xA6", true },
+  { "Gammad", "\xCF\x9C", false },
+  { "lozenge", "\xE2\x97\x8A", false },
+  { "fpartint", "\xE2\xA8\x8D", false },
+  { "LessLess", "\xE2\xAA\xA1", false },
+  { "eqcirc", "\xE2\x89\x96", false },
+  { "equiv", "\xE2\x89\xA1", false },
+  { "triplus", "\xE2\xA8\xB9", false },
+  { "eDot", "\xE2\x89\x91", false },
+  { "Ubreve", "\xC5\xAC", false },
+  { "NotRightTriangle", "\xE2\x8B\xAB", false },
+  { "emsp14", "\xE2\x80\x85", false },
+  { "NotLessSlantEqual", "\xE2\xA9\xBD\xCC\xB8", false },
+  { "lnsim", "\xE2\x8B\xA6", false },
+  { "GreaterEqualLess", "\xE2\x8B\x9B", false },
+  { "lrm", "\xE2\x80\x8E", false },
+  { "notinvc", "\xE2\x8B\xB6", false },
+  { "subdot", "\xE2\xAA\xBD", false },
+  { "luruhar", "\xE2\xA5\xA6", false },
+  { "puncsp", "\xE2\x80\x88", false },
+  { "", "", false },
+  { "scsim", "\xE2\x89\xBF", false },
+  { "upsih", "\xCF\x92", false },
+  { "euml", "\xC3\xAB", true },
+  { "varsigma", "\xCF\x82", false },
+  { "DoubleLongLeftRightArrow", "\xE2\x9F\xBA", false },
+  { "Not", "\xE2\xAB\xAC", false },
+  { "UnderBrace", "\xE2\x8F\x9F", false },
+  { "iocy", "\xD1\x91", false },
+  { "Cross", "\xE2\xA8\xAF", false },
+  { "xlArr", "\xE2\x9F\xB8", false },
+  { "lgE", "\xE2\xAA\x91", false },
+  { "equest", "\xE2\x89\x9F", false },
+  { "", "", false },
+  { "dsol", "\xE2\xA7\xB6", false },
+  { "boxhd", "\xE2\x94\xAC", false },
+  { "nlt", "\xE2\x89\xAE", false },
+  { "frac38", "\xE2\x85\x9C", false },
+  { "frac58", "\xE2\x85\x9D", false },
+  { "gesdotol", "\xE2\xAA\x84", false },
+  { "star", "\xE2\x98\x86", false },
+  { "ZeroWidthSpace", "\xE2\x80\x8B", false },
+  { "imagline", "\xE2\x84\x90", false },
+  { "gtrapprox", "\xE2\xAA\x86", false },
+  { "cemptyv", "\xE2\xA6\xB2", false },
+  { "ENG", "\xC5\x8A", false },
+  { "rAtail", "\xE2\xA4\x9C", false },
+  { "ocir", "\xE2\x8A\x9A", false },
+  { "rx", "\xE2\x84\x9E", false },
+  { "malt", "\xE2\x9C\xA0", false },
+  { "iukcy", "\xD1\x96", false },
+  { "RightTee", "\xE2\x8A\xA2", false },
+  { "Atilde", "\xC3\x83", true },
+  { "auml", "\xC3\xA4", true },
+  { "blacktriangleleft", "\xE2\x97\x82", false },
+  { "gla", "\xE2\xAA\xA5", false },
+  { "THORN", "\xC3\x9E", true },
+  { "rcaron", "\xC5\x99", false },
+  { "Rang", "\xE2\x9F\xAB", false },
+  { "rcedil", "\xC5\x97", false },
+  { "curarrm", "\xE2\xA4\xBC", false },
+  { "filig", "\xEF\xAC\x81", false },
+  { "ngE", "\xE2\x89\xA7\xCC\xB8", false },
+  { "nequiv", "\xE2\x89\xA2", false },
+  { "varpropto", "\xE2\x88\x9D", false },
+  { "DoubleContourIntegral", "\xE2\x88\xAF", false },
+  { "qint", "\xE2\xA8\x8C", false },
+  { "searr", "\xE2\x86\x98", false },
+  { "twixt", "\xE2\x89\xAC", false },
+  { "GreaterGreater", "\xE2\xAA\xA2", false },
+  { "ubrcy", "\xD1\x9E", false },
+  { "vnsub", "\xE2\x8A\x82\xE2\x83\x92", false },
+  { "DotEqual", "\xE2\x89\x90", false },
+  { "NotGreaterSlantEqual", "\xE2\xA9\xBE\xCC\xB8", false },
+  { "psi", "\xCF\x88", false },
+  { "equivDD", "\xE2\xA9\xB8", false },
+  { "minus", "\xE2\x88\x92", false },
+  { "mid", "\xE2\x88\xA3", false },
+  { "olarr", "\xE2\x86\xBA", false },
+  { "", "", false },
+  { "", "", false },
+  { "boxV", "\xE2\x95\x91", false },
+  { "upsi", "\xCF\x85", false },
+  { "rho", "\xCF\x81", false },
+  { "rmoust", "\xE2\x8E\xB1", false },
+  { "frac14", "\xC2\xBC", true },
+  { "spar", "\xE2\x88\xA5", false },
+  { "Nscr", "\xF0\x9D\x92\xA9", false },
+  { "rsquo", "\xE2\x80\x99", false },
+  { "vert", "\x7C", false },
+  { "opar", "\xE2\xA6\xB7", false },
+  { "nleftrightarrow", "\xE2\x86\xAE", false },
+  { "trisb", "\xE2\xA7\x8D", false },
+  { "", "", false },
+  { "", "", false },
+  { "disin", "\xE2\x8B\xB2", false },
+  { "ordf", "\xC2\xAA", true },
+  { "imped", "\xC6\xB5", false },
+  { "natur", "\xE2\x99\xAE", false },
+  { "", "", false },
+  { "", "", false },
+  { "Gopf", "\xF0\x9D\x94\xBE", false },
+  { "apid", "\xE2\x89\x8B", false },
+  { "backcong", "\xE2\x89\x8C", false },
+  { "eth", "\xC3\xB0", true },
+  { "mcomma", "\xE2\xA8\xA9", false },
+  { "rdca", "\xE2\xA4\xB7", false },
+  { "nap", "\xE2\x89\x89", false },
+  { "ascr", "\xF0\x9D\x92\xB6", false },
+  { "", "", false },
+  { "tscy", "\xD1\x86", false },
+  { "nVDash", "\xE2\x8A\xAF", false },
+  { "Umacr", "\xC5\xAA", false },
+  { "icirc", "\xC3\xAE", true },
+  { "vDash", "\xE2\x8A\xA8", false },
+  { "Lcaron", "\xC4\xBD", false },
+  { "lAarr", "\xE2\x87\x9A", false },
+  { "IJlig", "\xC4\xB2", false },
+  { "amp", "\x26", true },
+  { "Tab", "\x09", false },
+  { "blacktriangledown", "\xE2\x96\xBE", false },
+  { "LeftTriangleBar", "\xE2\xA7\x8F", false },
+  { "LeftCeiling", "\xE2\x8C\x88", false },
+  { "vprop", "\xE2\x88\x9D", false },
+  { "rightharpoonup", "\xE2\x87\x80", false },
+  { "beth", "\xE2\x84\xB6", false },
+  { "Yfr", "\xF0\x9D\x94\x9C", false },
+  { "llcorner", "\xE2\x8C\x9E", false },
+  { "Rscr", "\xE2\x84\x9B", false },
+  { "sung", "\xE2\x99\xAA", false },
+  { "bnot", "\xE2\x8C\x90", false },
+  { "Mcy", "\xD0\x9C", false },
+  { "leftharpoondown", "\xE2\x86\xBD", false },
+  { "doteq", "\xE2\x89\x90", false },
+  { "rtrie", "\xE2\x8A\xB5", false },
+  { "", "", false },
+  { "bowtie", "\xE2\x8B\x88", false },
+  { "midcir", "\xE2\xAB\xB0", false },
+  { "epsiv", "\xCF\xB5", false },
+  { "Dcaron", "\xC4\x8E", false },
+  { "Igrave", "\xC3\x8C", true },
+  { "ngeq", "\xE2\x89\xB1", false },
+  { "nscr", "\xF0\x9D\x93\x83", false },
+  { "boxplus", "\xE2\x8A\x9E", false },
+  { "ni", "\xE2\x88\x8B", false },
+  { "ldrdhar", "\xE2\xA5\xA7", false },
+  { "ecolon", "\xE2\x89\x95", false },
+  { "NotSucceedsSlantEqual", "\xE2\x8B\xA1", false },
+  { "backsimeq", "\xE2\x8B\x8D", false },
+  { "", "", false },
+  { "div", "\xC3\xB7", false },
+  { "cirmid", "\xE2\xAB\xAF", false },
+  { "", "", false },
+  { "subsup", "\xE2\xAB\x93", false },
+  { "amalg", "\xE2\xA8\xBF", false },
+  { "boxvL", "\xE2\x95\xA1", false },
+  { "isinsv", "\xE2\x8B\xB3", false },
+  { "npar", "\xE2\x88\xA6", false },
+  { "Rho", "\xCE\xA1", false },
+  { "Product", "\xE2\x88\x8F", false },
+  { "trianglerighteq", "\xE2\x8A\xB5", false },
+  { "phi", "\xCF\x86", false },
+  { "", "", false },
+  { "supseteqq", "\xE2\xAB\x86", false },
+  { "ges", "\xE2\xA9\xBE", false },
+  { "", "", false },
+  { "IEcy", "\xD0\x95", false },
+  { "GreaterTilde", "\xE2\x89\xB3", false },
+  { "eqsim", "\xE2\x89\x82", false },
+  { "", "", false },
+  { "", "", false },
+  { "ltrPar", "\xE2\xA6\x96", false },
+  { "Cscr", "\xF0\x9D\x92\x9E", false },
+  { "KHcy", "\xD0\xA5", false },
+  { "ffilig", "\xEF\xAC\x83", false },
+  { "naturals", "\xE2\x84\x95", false },
+  { "Ocy", "\xD0\x9E", false },
+  { "nsubE", "\xE2\xAB\x85\xCC\xB8", false },
+  { "", "", false },
+  { "RightUpVectorBar", "\xE2\xA5\x94", false },
+  { "ltrif", "\xE2\x97\x82", false },
+  { "Cfr", "\xE2\x84\xAD", false },
+  { "Esim", "\xE2\xA9\xB3", false },
+  { "pluse", "\xE2\xA9\xB2", false },
+  { "NotCongruent", "\xE2\x89\xA2", false },
+  { "frac45", "\xE2\x85\x98", false },
+  { "odsold", "\xE2\xA6\xBC", false },
+  { "", "", false },
+  { "lbrksld", "\xE2\xA6\x8F", false },
+  { "smeparsl", "\xE2\xA7\xA4", false },
+  { "rbrace", "\x7D", false },
+  { "bigsqcup", "\xE2\xA8\x86", false },
+  { "erDot", "\xE2\x89\x93", false },
+  { "", "", false },
+  { "pre", "\xE2\xAA\xAF", false },
+  { "NotLessLess", "\xE2\x89\xAA\xCC\xB8", false },
+  { "egs", "\xE2\xAA\x96", false },
+  { "", "", false },
+  { "Jfr", "\xF0\x9D\x94\x8D", false },
+  { "barwed", "\xE2\x8C\x85", false },
+  { "loz", "\xE2\x97\x8A", false },
+  { "lEg", "\xE2\xAA\x8B", false },
+  { "pitchfork", "\xE2\x8B\x94", false },
+  { "nwnear", "\xE2\xA4\xA7", false },
+  { "late", "\xE2\xAA\xAD", false },
+  { "downarrow", "\xE2\x86\x93", false },
+  { "rightarrowtail", "\xE2\x86\xA3", false },
+  { "fcy", "\xD1\x84", false },
+  { "", "", false },
+  { "RightArrow", "\xE2\x86\x92", false },
+  { "RightDoubleBracket", "\xE2\x9F\xA7", false },
+  { "thkap", "\xE2\x89\x88", false },
+  { "Because", "\xE2\x88\xB5", false },
+  { "OverBrace", "\xE2\x8F\x9E", false },
+  { "Tilde", "\xE2\x88\xBC", false },
+  { "tcedil", "\xC5\xA3", false },
+  { "smid", "\xE2\x88\xA3", false },
+  { "awconint", "\xE2\x88\xB3", false },
+  { "ltrie", "\xE2\x8A\xB4", false },
+  { "Cap", "\xE2\x8B\x92", false },
+  { "ltlarr", "\xE2\xA5\xB6", false },
+  { "NotNestedGreaterGreater", "\xE2\xAA\xA2\xCC\xB8", false },
+  { "ncy", "\xD0\xBD", false },
+  { "acirc", "\xC3\xA2", true },
+  { "boxh", "\xE2\x94\x80", false },
+  { "Jsercy", "\xD0\x88", false },
+  { "forall", "\xE2\x88\x80", false },
+  { "Updownarrow", "\xE2\x87\x95", false },
+  { "", "", false },
+  { "lcub", "\x7B", false },
+  { "ltimes", "\xE2\x8B\x89", false },
+  { "precapprox", "\xE2\xAA\xB7", false },
+  { "Ouml", "\xC3\x96", true },
+  { "larrbfs", "\xE2\xA4\x9F", false },
+  { "cups", "\xE2\x88\xAA\xEF\xB8\x80", false },
+  { "uHar", "\xE2\xA5\xA3", false },
+  { "DJcy", "\xD0\x82", false },
+  { "scnap", "\xE2\xAA\xBA", false },
+  { "boxv", "\xE2\x94\x82", false },
+  { "looparrowright", "\xE2\x86\xAC", false },
+  { "eqslantless", "\xE2\xAA\x95", false },
+  { "blank", "\xE2\x90\xA3", false },
+  { "", "", false },
+  { "tfr", "\xF0\x9D\x94\xB1", false },
+  { "Uparrow", "\xE2\x87\x91", false },
+  { "zopf", "\xF0\x9D\x95\xAB", false },
+  { "rsh", "\xE2\x86\xB1", false },
+  { "langle", "\xE2\x9F\xA8", false },
+  { "", "", false },
+  { "gacute", "\xC7\xB5", false },
+  { "boxdL", "\xE2\x95\x95", false },
+  { "ccupssm", "\xE2\xA9\x90", false },
+  { "cacute", "\xC4\x87", false },
+  { "quatint", "\xE2\xA8\x96", false },
+  { "boxUl", "\xE2\x95\x9C", false },
+  { "", "", false },
+  { "", "", false },
+  { "", "", false },
+  { "glE", "\xE2\xAA\x92", false },
+  { "daleth", "\xE2\x84\xB8", false },
+  { "Backslash", "\xE2\x88\x96", false },
+  { "", "", false },
+  { "uuml", "\xC3\xBC", true },
+  { "capcup", "\xE2\xA9\x87", false },
+  { "varrho", "\xCF\xB1", false },
+  { "hamilt", "\xE2\x84\x8B", false },
+  { "congdot", "\xE2\xA9\xAD", false },
+  { "supsim", "\xE2\xAB\x88", false },
+  { "solb", "\xE2\xA7\x84", false },
+  { "seArr", "\xE2\x87\x98", false },
+  { "lbrkslu", "\xE2\xA6\x8D", false },
+  { "Poincareplane", "\xE2\x84\x8C", false },
+  { "", "", false },
+  { "submult", "\xE2\xAB\x81", false },
+  { "Aacute", "\xC3\x81", true },
+  { "flat", "\xE2\x99\xAD", false },
+  { "ccups", "\xE2\xA9\x8C", false },
+  { "nrightarrow", "\xE2\x86\x9B", false },
+  { "ac", "\xE2\x88\xBE", false },
+  { "Acy", "\xD0\x90", false },
+  { "LessEqualGreater", "\xE2\x8B\x9A", false },
+  { "Longleftrightarrow", "\xE2\x9F\xBA", false },
+  { "efr", "\xF0\x9D\x94\xA2", false },
+  { "", "", false },
+  { "blacklozenge", "\xE2\xA7\xAB", false },
+  { "mscr", "\xF0\x9D\x93\x82", false },
+  { "subsim", "\xE2\xAB\x87", false },
+  { "gap", "\xE2\xAA\x86", false },
+  { "lArr", "\xE2\x87\x90", false },
+  { "orarr", "\xE2\x86\xBB", false },
+  { "check", "\xE2\x9C\x93", false },
+  { "chcy", "\xD1\x87", false },
+  { "nlE", "\xE2\x89\xA6\xCC\xB8", false },
+  { "emsp", "\xE2\x80\x83", false },
+  { "micro", "\xC2\xB5", true },
+  { "ggg", "\xE2\x8B\x99", false },
+  { "varr", "\xE2\x86\x95", false },
+  { "LessFullEqual", "\xE2\x89\xA6", false },
+  { "frac18", "\xE2\x85\x9B", false },
+  { "timesb", "\xE2\x8A\xA0", false },
+  { "Wcirc", "\xC5\xB4", false },
+  { "dlcorn", "\xE2\x8C\x9E", false },
+  { "bullet", "\xE2\x80\xA2", false },
+  { "", "", false },
+  { "Vvdash", "\xE2\x8A\xAA", false },
+  { "Sigma", "\xCE\xA3", false },
+  { "fscr", "\xF0\x9D\x92\xBB", false },
+  { "OverBar", "\xE2\x80\xBE", false },
+  { "vnsup", "\xE2\x8A\x83\xE2\x83\x92", false },
+  { "lrhar", "\xE2\x87\x8B", false },
+  { "sccue", "\xE2\x89\xBD", false },
+  { "suplarr", "\xE2\xA5\xBB", false },
+  { "triminus", "\xE2\xA8\xBA", false },
+  { "doublebarwedge", "\xE2\x8C\x86", false },
+  { "rarrc", "\xE2\xA4\xB3", false },
+  { "lrtri", "\xE2\x8A\xBF", false },
+  { "lharul", "\xE2\xA5\xAA", false },
+  { "", "", false },
+  { "ffr", "\xF0\x9D\x94\xA3", false },
+  { "vartheta", "\xCF\x91", false },
+  { "ucirc", "\xC3\xBB", true },
+  { "wfr", "\xF0\x9D\x94\xB4", false },
+  { "blacktriangle", "\xE2\x96\xB4", false },
+  { "boxUR", "\xE2\x95\x9A", false },
+  { "topcir", "\xE2\xAB\xB1", false },
+  { "uharr", "\xE2\x86\xBE", false },
+  { "", "", false },
+  { "circledcirc", "\xE2\x8A\x9A", false },
+  { "utrif", "\xE2\x96\xB4", false },
+  { "swarr", "\xE2\x86\x99", false },
+  { "gneqq", "\xE2\x89\xA9", false },
+  { "supseteq", "\xE2\x8A\x87", false },
+  { "zcy", "\xD0\xB7", false },
+  { "tcy", "\xD1\x82", false },
+  { "ncap", "\xE2\xA9\x83", false },
+  { "twoheadleftarrow", "\xE2\x86\x9E", false },
+  { "diamond", "\xE2\x8B\x84", false },
+  { "dotminus", "\xE2\x88\xB8", false },
+  { "npre", "\xE2\xAA\xAF\xCC\xB8", false },
+  { "egsdot", "\xE2\xAA\x98", false },
+  { "isinv", "\xE2\x88\x88", false },
+  { "duhar", "\xE2\xA5\xAF", false },
+  { "", "", false },
+  { "emptyset", "\xE2\x88\x85", false },
+  { "caps", "\xE2\x88\xA9\xEF\xB8\x80", false },
+  { "Zopf", "\xE2\x84\xA4", false },
+  { "lbbrk", "\xE2\x9D\xB2", false },
+  { "", "", false },
+  { "uring", "\xC5\xAF", false },
+  { "NotTilde", "\xE2\x89\x81", false },
+  { "equals", "\x3D", false },
+  { "oopf", "\xF0\x9D\x95\xA0", false },
+  { "asymp", "\xE2\x89\x88", false },
+  { "EqualTilde", "\xE2\x89\x82", false },
+  { "nvsim", "\xE2\x88\xBC\xE2\x83\x92", false },
+  { "nedot", "\xE2\x89\x90\xCC\xB8", false },
+  { "", "", false },
+  { "DoubleDot", "\xC2\xA8", false },
+  { "Eta", "\xCE\x97", false },
+  { "rfloor", "\xE2\x8C\x8B", false },
+  { "oslash", "\xC3\xB8", true },
+  { "cirE", "\xE2\xA7\x83", false },
+  { "angzarr", "\xE2\x8D\xBC", false },
+  { "sol", "\x2F", false },
+  { "drcrop", "\xE2\x8C\x8C", false },
+  { "gel", "\xE2\x8B\x9B", false },
+  { "nltrie", "\xE2\x8B\xAC", false },
+  { "Aring", "\xC3\x85", true },
+  { "cwint", "\xE2\x88\xB1", false },
+  { "", "", false },
+  { "AElig", "\xC3\x86", true },
+  { "kcy", "\xD0\xBA", false },
+  { "gammad", "\xCF\x9D", false },
+  { "larrpl", "\xE2\xA4\xB9", false },
+  { "ldsh", "\xE2\x86\xB2", false },
+  { "", "", false },
+  { "nhArr", "\xE2\x87\x8E", false },
+  { "", "", false },
+  { "Exists", "\xE2\x88\x83", false },
+  { "hookrightarrow", "\xE2\x86\xAA", false },
+  { "cir", "\xE2\x97\x8B", false },
+  { "ncongdot", "\xE2\xA9\xAD\xCC\xB8", false },
+  { "", "", false },
+  { "LowerLeftArrow", "\xE2\x86\x99", false },
+  { "frac23", "\xE2\x85\x94", false },
+  { "", "", false },
+  { "ctdot", "\xE2\x8B\xAF", false },
+  { "", "", false },
+  { "pertenk", "\xE2\x80\xB1", false },
+  { "prod", "\xE2\x88\x8F", false },
+  { "ecirc", "\xC3\xAA", true },
+  { "", "", false },
+  { "cupcup", "\xE2\xA9\x8A", false },
+  { "Dfr", "\xF0\x9D\x94\x87", false },
+  { "RightTriangle", "\xE2\x8A\xB3", false },
+  { "xuplus", "\xE2\xA8\x84", false },
+  { "boxH", "\xE2\x95\x90", false },
+  { "boxHu", "\xE2\x95\xA7", false },
+  { "", "", false },
+  { "rfisht", "\xE2\xA5\xBD", false },
+  { "Wedge", "\xE2\x8B\x80", false },
+  { "leftarrow", "\xE2\x86\x90", false },
+  { "Verbar", "\xE2\x80\x96", false },
+  { "", "", false },
+  { "", "", false },
+  { "jscr", "\xF0\x9D\x92\xBF", false },
+  { "gg", "\xE2\x89\xAB", false },
+  { "kappav", "\xCF\xB0", false },
+  { "qscr", "\xF0\x9D\x93\x86", false },
+  { "complexes", "\xE2\x84\x82", false },
+  { "", "", false },
+  { "permil", "\xE2\x80\xB0", false },
+  { "EmptyVerySmallSquare", "\xE2\x96\xAB", false },
+  { "oscr", "\xE2\x84\xB4", false },
+  { "pi", "\xCF\x80", false },
+  { "Scaron", "\xC5\xA0", false },
+  { "rarrlp", "\xE2\x86\xAC", false },
+  { "oelig", "\xC5\x93", false },
+  { "parallel", "\xE2\x88\xA5", false },
+  { "kjcy", "\xD1\x9C", false },
+  { "siml", "\xE2\xAA\x9D", false },
+  { "DownLeftVector", "\xE2\x86\xBD", false },
+  { "PrecedesTilde", "\xE2\x89\xBE", false },
+  { "notindot", "\xE2\x8B\xB5\xCC\xB8", false },
+  { "", "", false },
+  { "pr", "\xE2\x89\xBA", false },
+  { "RBarr", "\xE2\xA4\x90", false },
+  { "Ocirc", "\xC3\x94", true },
+  { "", "", false },
+  { "gopf", "\xF0\x9D\x95\x98", false },
+  { "ncaron", "\xC5\x88", false },
+  { "HumpDownHump", "\xE2\x89\x8E", false },
+  { "Lang", "\xE2\x9F\xAA", false },
+  { "curlywedge", "\xE2\x8B\x8F", false },
+  { "edot", "\xC4\x97", false },
+  { "die", "\xC2\xA8", false },
+  { "UpEquilibrium", "\xE2\xA5\xAE", false },
+  { "", "", false },
+  { "Vbar", "\xE2\xAB\xAB", false },
+  { "rcub", "\x7D", false },
+  { "lvertneqq", "\xE2\x89\xA8\xEF\xB8\x80", false },
+  { "lesdoto", "\xE2\xAA\x81", false },
+  { "boxDr", "\xE2\x95\x93", false },
+  { "Equal", "\xE2\xA9\xB5", false },
+  { "Pscr", "\xF0\x9D\x92\xAB", false },
+  { "", "", false },
+  { "lneq", "\xE2\xAA\x87", false },
+  { "straightepsilon", "\xCF\xB5", false },
+  { "UpperRightArrow", "\xE2\x86\x97", false },
+  { "iscr", "\xF0\x9D\x92\xBE", false },
+  { "triangleq", "\xE2\x89\x9C", false },
+  { "", "", false },
+  { "succsim", "\xE2\x89\xBF", false },
+  { "bepsi", "\xCF\xB6", false },
+  { "ropar", "\xE2\xA6\x86", false },
+  { "", "", false },
+  { "varnothing", "\xE2\x88\x85", false },
+  { "Gg", "\xE2\x8B\x99", false },
+  { "ffllig", "\xEF\xAC\x84", false },
+  { "SupersetEqual", "\xE2\x8A\x87", false },
+  { "Vopf", "\xF0\x9D\x95\x8D", false },
+  { "RoundImplies", "\xE2\xA5\xB0", false },
+  { "lne", "\xE2\xAA\x87", false },
+  { "divideontimes", "\xE2\x8B\x87", false },
+  { "", "", false },
+  { "leftrightsquigarrow", "\xE2\x86\xAD", false },
+  { "ReverseElement", "\xE2\x88\x8B", false },
+  { "blacktriangleright", "\xE2\x96\xB8", false },
+  { "Tstrok", "\xC5\xA6", false },
+  { "simeq", "\xE2\x89\x83", false },
+  { "Udblac", "\xC5\xB0", false },
+  { "andd", "\xE2\xA9\x9C", false },
+  { "nesear", "\xE2\xA4\xA8", false },
+  { "bsime", "\xE2\x8B\x8D", false },
+  { "succneqq", "\xE2\xAA\xB6", false },
+  { "sqsupe", "\xE2\x8A\x92", false },
+  { "jsercy", "\xD1\x98", false },
+  { "LeftRightVector", "\xE2\xA5\x8E", false },
+  { "ycirc", "\xC5\xB7", false },
+  { "toea", "\xE2\xA4\xA8", false },
+  { "lacute", "\xC4\xBA", false },
+  { "", "", false },
+  { "", "", false },
+  { "Barv", "\xE2\xAB\xA7", false },
+  { "mapsto", "\xE2\x86\xA6", false },
+  { "", "", false },
+  { "nshortmid", "\xE2\x88\xA4", false },
+  { "nearhk", "\xE2\xA4\xA4", false },
+  { "phmmat", "\xE2\x84\xB3", false },
+  { "LeftVector", "\xE2\x86\xBC", false },
+  { "NotPrecedesSlantEqual", "\xE2\x8B\xA0", false },
+  { "hookleftarrow", "\xE2\x86\xA9", false },
+  { "", "", false },
+  { "nlarr", "\xE2\x86\x9A", false },
+  { "srarr", "\xE2\x86\x92", false },
+  { "oline", "\xE2\x80\xBE", false },
+  { "map", "\xE2\x86\xA6", false },
+  { "ldca", "\xE2\xA4\xB6", false },
+  { "NotRightTriangleBar", "\xE2\xA7\x90\xCC\xB8", false },
+  { "njcy", "\xD1\x9A", false },
+  { "mlcp", "\xE2\xAB\x9B", false },
+  { "mu", "\xCE\xBC", false },
+  { "mopf", "\xF0\x9D\x95\x9E", false },
+  { "notinvb", "\xE2\x8B\xB7", false },
+  { "", "", false },
+  { "LongRightArrow", "\xE2\x9F\xB6", false },
+  { "squarf", "\xE2\x96\xAA", false },
+  { "nldr", "\xE2\x80\xA5", false },
+  { "succnapprox", "\xE2\xAA\xBA", false },
+  { "omid", "\xE2\xA6\xB6", false },
+  { "SquareUnion", "\xE2\x8A\x94", false },
+  { "UnionPlus", "\xE2\x8A\x8E", false },
+  { "Hfr", "\xE2\x84\x8C", false },
+  { "lowast", "\xE2\x88\x97", false },
+  { "andslope", "\xE2\xA9\x98", false },
+  { "angle", "\xE2\x88\xA0", false },
+  { "primes", "\xE2\x84\x99", false },
+  { "boxHd", "\xE2\x95\xA4", false },
+  { "gE", "\xE2\x89\xA7", false },
+  { "isin", "\xE2\x88\x88", false },
+  { "duarr", "\xE2\x87\xB5", false },
+  { "omicron", "\xCE\xBF", false },
+  { "rbarr", "\xE2\xA4\x8D", false },
+  { "Vscr", "\xF0\x9D\x92\xB1", false },
+  { "LessGreater", "\xE2\x89\xB6", false },
+  { "Downarrow", "\xE2\x87\x93", false },
+  { "CircleDot", "\xE2\x8A\x99", false },
+  { "nsimeq", "\xE2\x89\x84", false },
+  { "", "", false },
+  { "quaternions", "\xE2\x84\x8D", false },
+  { "zeta", "\xCE\xB6", false },
+  { "", "", false },
+  { "zwnj", "\xE2\x80\x8C", false },
+  { "nsup", "\xE2\x8A\x85", false },
+  { "dtdot", "\xE2\x8B\xB1", false },
+  { "prsim", "\xE2\x89\xBE", false },
+  { "gscr", "\xE2\x84\x8A", false },
+  { "not", "\xC2\xAC", true },
+  { "simplus", "\xE2\xA8\xA4", false },
+  { "eacute", "\xC3\xA9", true },
+  { "ntlg", "\xE2\x89\xB8", false },
+  { "hbar", "\xE2\x84\x8F", false },
+  { "Wscr", "\xF0\x9D\x92\xB2", false },
+  { "Qfr", "\xF0\x9D\x94\x94", false },
+  { "gtlPar", "\xE2\xA6\x95", false },
+  { "DownTeeArrow", "\xE2\x86\xA7", false },
+  { "xharr", "\xE2\x9F\xB7", false },
+  { "isindot", "\xE2\x8B\xB5", false },
+  { "triangle", "\xE2\x96\xB5", false },
+  { "DoubleUpDownArrow", "\xE2\x87\x95", false },
+  { "iogon", "\xC4\xAF", false },
+  { "Copf", "\xE2\x84\x82", false },
+  { "cap", "\xE2\x88\xA9", false },
+  { "leftrightarrow", "\xE2\x86\x94", false },
+  { "RightDownVector", "\xE2\x87\x82", false },
+  { "tdot", "\xE2\x83\x9B", false },
+  { "sqsub", "\xE2\x8A\x8F", false },
+  { "angmsdaf", "\xE2\xA6\xAD", false },
+  { "iuml", "\xC3\xAF", true },
+  { "rhard", "\xE2\x87\x81", false },
+  { "boxVl", "\xE2\x95\xA2", false },
+  { "Ncedil", "\xC5\x85", false },
+  { "lsime", "\xE2\xAA\x8D", false },
+  { "yfr", "\xF0\x9D\x94\xB6", false },
+  { "", "", false },
+  { "ominus", "\xE2\x8A\x96", false },
+  { "rthree", "\xE2\x8B\x8C", false },
+  { "cirfnint", "\xE2\xA8\x90", false },
+  { "ocy", "\xD0\xBE", false },
+  { "rdsh", "\xE2\x86\xB3", false },
+  { "bigcup", "\xE2\x8B\x83", false },
+  { "upsilon", "\xCF\x85", false },
+  { "", "", false },
+  { "Hstrok", "\xC4\xA6", false },
+  { "Ograve", "\xC3\x92", true },
+  { "plusdu", "\xE2\xA8\xA5", false },
+  { "", "", false },
+  { "uacute", "\xC3\xBA", true },
+  { "DScy", "\xD0\x85", false },
+  { "sup3", "\xC2\xB3", true },
+  { "", "", false },
+  { "pfr", "\xF0\x9D\x94\xAD", false },
+  { "angmsdaa", "\xE2\xA6\xA8", false },
+  { "NotEqual", "\xE2\x89\xA0", false },
+  { "subsub", "\xE2\xAB\x95", false },
+  { "iprod", "\xE2\xA8\xBC", false },
+  { "oS", "\xE2\x93\x88", false },
+  { "vltri", "\xE2\x8A\xB2", false },
+  { "drcorn", "\xE2\x8C\x9F", false },
+  { "bull", "\xE2\x80\xA2", false },
+  { "NotLeftTriangleBar", "\xE2\xA7\x8F\xCC\xB8", false },
+  { "dharr", "\xE2\x87\x82", false },
+  { "ccaron", "\xC4\x8D", false },
+  { "SucceedsTilde", "\xE2\x89\xBF", false },
+  { "lfloor", "\xE2\x8C\x8A", false },
+  { "Rsh", "\xE2\x86\xB1", false },
+  { "mho", "\xE2\x84\xA7", false },
+  { "SucceedsEqual", "\xE2\xAA\xB0", false },
+  { "rightrightarrows", "\xE2\x87\x89", false },
+  { "dArr", "\xE2\x87\x93", false },
+  { "rbrksld", "\xE2\xA6\x8E", false },
+  { "gamma", "\xCE\xB3", false },
+  { "Icy", "\xD0\x98", false },
+  { "downharpoonright", "\xE2\x87\x82", false },
+  { "scpolint", "\xE2\xA8\x93", false },
+  { "UpTee", "\xE2\x8A\xA5", false },
+  { "", "", false },
+  { "", "", false },
+  { "nvinfin", "\xE2\xA7\x9E", false },
+  { "Mopf", "\xF0\x9D\x95\x84", false },
+  { "gimel", "\xE2\x84\xB7", false },
+  { "", "", false },
+  { "DoubleVerticalBar", "\xE2\x88\xA5", false },
+  { "COPY", "\xC2\xA9", true },
+  { "DZcy", "\xD0\x8F", false },
+  { "ShortDownArrow", "\xE2\x86\x93", false },
+  { "PrecedesSlantEqual", "\xE2\x89\xBC", false },
+  { "rppolint", "\xE2\xA8\x92", false },
+  { "rarrtl", "\xE2\x86\xA3", false },
+  { "RightArrowLeftArrow", "\xE2\x87\x84", false },
+  { "circleddash", "\xE2\x8A\x9D", false },
+  { "ldquor", "\xE2\x80\x9E", false },
+  { "downdownarrows", "\xE2\x87\x8A", false },
+  { "circ", "\xCB\x86", false },
+  { "", "", false },
+  { "DownRightTeeVector", "\xE2\xA5\x9F", false },
+  { "isins", "\xE2\x8B\xB4", false },
+  { "amacr", "\xC4\x81", false },
+  { "blk14", "\xE2\x96\x91", false },
+  { "orv", "\xE2\xA9\x9B", false },
+  { "Sum", "\xE2\x88\x91", false },
+  { "udhar", "\xE2\xA5\xAE", false },
+  { "RightVectorBar", "\xE2\xA5\x93", false },
+  { "nexist", "\xE2\x88\x84", false },
+  { "nopf", "\xF0\x9D\x95\x9F", false },
+  { "sum", "\xE2\x88\x91", false },
+  { "larrb", "\xE2\x87\xA4", false },
+  { "", "", false },
+  { "Tcaron", "\xC5\xA4", false },
+  { "lescc", "\xE2\xAA\xA8", false },
+  { "bigoplus", "\xE2\xA8\x81", false },
+  { "Wfr", "\xF0\x9D\x94\x9A", false },
+  { "bscr", "\xF0\x9D\x92\xB7", false },
+  { "nvlt", "\x3C\xE2\x83\x92", false },
+  { "xodot", "\xE2\xA8\x80", false },
+  { "midast", "\x2A", false },
+  { "intercal", "\xE2\x8A\xBA", false },
+  { "Square", "\xE2\x96\xA1", false },
+  { "cuepr", "\xE2\x8B\x9E", false },
+  { "lceil", "\xE2\x8C\x88", false },
+  { "models", "\xE2\x8A\xA7", false },
+  { "", "", false },
+  { "lates", "\xE2\xAA\xAD\xEF\xB8\x80", false },
+  { "andand", "\xE2\xA9\x95", false },
+  { "Nopf", "\xE2\x84\x95", false },
+  { "", "", false },
+  { "RightFloor", "\xE2\x8C\x8B", false },
+  { "Gcy", "\xD0\x93", false },
+  { "Dstrok", "\xC4\x90", false },
+  { "Kappa", "\xCE\x9A", false },
+  { "vartriangleleft", "\xE2\x8A\xB2", false },
+  { "", "", false },
+  { "jopf", "\xF0\x9D\x95\x9B", false },
+  { "supsup", "\xE2\xAB\x96", false },
+  { "swArr", "\xE2\x87\x99", false },
+  { "lltri", "\xE2\x97\xBA", false },
+  { "period", "\x2E", false },
+  { "euro", "\xE2\x82\xAC", false },
+  { "frac25", "\xE2\x85\x96", false },
+  { "triangleright", "\xE2\x96\xB9", false },
+  { "exponentiale", "\xE2\x85\x87", false },
+  { "Intersection", "\xE2\x8B\x82", false },
+  { "strns", "\xC2\xAF", false },
+  { "les", "\xE2\xA9\xBD", false },
+  { "", "", false },
+  { "", "", false },
+  { "lmidot", "\xC5\x80", false },
+  { "aopf", "\xF0\x9D\x95\x92", false },
+  { "bsolhsub", "\xE2\x9F\x88", false },
+  { "zacute", "\xC5\xBA", false },
+  { "Rrightarrow", "\xE2\x87\x9B", false },
+  { "alpha", "\xCE\xB1", false },
+  { "sim", "\xE2\x88\xBC", false },
+  { "subne", "\xE2\x8A\x8A", false },
+  { "Jcy", "\xD0\x99", false },
+  { "Ifr", "\xE2\x84\x91", false },
+  { "subE", "\xE2\xAB\x85", false },
+  { "NegativeThinSpace", "\xE2\x80\x8B", false },
+  { "plussim", "\xE2\xA8\xA6", false },
+  { "", "", false },
+  { "yuml", "\xC3\xBF", true },
+  { "", "", false },
+  { "sup", "\xE2\x8A\x83", false },
+  { "", "", false },
+  { "", "", false },
+  { "ClockwiseContourIntegral", "\xE2\x88\xB2", false },
+  { "ge", "\xE2\x89\xA5", false },
+  { "Acirc", "\xC3\x82", true },
+  { "jmath", "\xC8\xB7", false },
+  { "sqsupset", "\xE2\x8A\x90", false },
+  { "SquareSuperset", "\xE2\x8A\x90", false },
+  { "", "", false },
+  { "vartriangleright", "\xE2\x8A\xB3", false },
+  { "DownArrow", "\xE2\x86\x93", false },
+  { "nleftarrow", "\xE2\x86\x9A", false },
+  { "", "", false },
+  { "urcorner", "\xE2\x8C\x9D", false },
+  { "uharl", "\xE2\x86\xBF", false },
+  { "urcrop", "\xE2\x8C\x8E", false },
+  { "leftrightharpoons", "\xE2\x87\x8B", false },
+  { "uhblk", "\xE2\x96\x80", false },
+  { "Lleftarrow", "\xE2\x87\x9A", false },
+  { "", "", false },
+  { "omega", "\xCF\x89", false },
+  { "lagran", "\xE2\x84\x92", false },
+  { "nsc", "\xE2\x8A\x81", false },
+  { "esim", "\xE2\x89\x82", false },
+  { "bot", "\xE2\x8A\xA5", false },
+  { "CupCap", "\xE2\x89\x8D", false },
+  { "lvnE", "\xE2\x89\xA8\xEF\xB8\x80", false },
+  { "nsub", "\xE2\x8A\x84", false },
+  { "gtreqqless", "\xE2\xAA\x8C", false },
+  { "Union", "\xE2\x8B\x83", false },
+  { "smt", "\xE2\xAA\xAA", false },
+  { "simlE", "\xE2\xAA\x9F", false },
+  { "cfr", "\xF0\x9D\x94\xA0", false },
+  { "frac12", "\xC2\xBD", true },
+  { "smallsetminus", "\xE2\x88\x96", false },
+  { "", "", false },
+  { "vArr", "\xE2\x87\x95", false },
+  { "RightCeiling", "\xE2\x8C\x89", false },
+  { "bopf", "\xF0\x9D\x95\x93", false },
+  { "Xi", "\xCE\x9E", false },
+  { "reg", "\xC2\xAE", true },
+  { "", "", false },
+  { "Iuml", "\xC3\x8F", true },
+  { "", "", false },
+  { "", "", false },
+  { "lnapprox", "\xE2\xAA\x89", false },
+  { "nvrtrie", "\xE2\x8A\xB5\xE2\x83\x92", false },
+  { "", "", false },
+  { "VerticalSeparator", "\xE2\x9D\x98", false },
+  { "DownRightVectorBar", "\xE2\xA5\x97", false },
+  { "notinva", "\xE2\x88\x89", false },
+  { "Lacute", "\xC4\xB9", false },
+  { "scE", "\xE2\xAA\xB4", false },
+  { "DotDot", "\xE2\x83\x9C", false },
+  { "geqslant", "\xE2\xA9\xBE", false },
+  { "measuredangle", "\xE2\x88\xA1", false },
+  { "", "", false },
+  { "Colon", "\xE2\x88\xB7", false },
+  { "swarrow", "\xE2\x86\x99", false },
+  { "nearr", "\xE2\x86\x97", false },
+  { "angmsdah", "\xE2\xA6\xAF", false },
+  { "Gscr", "\xF0\x9D\x92\xA2", false },
+  { "", "", false },
+  { "DoubleRightArrow", "\xE2\x87\x92", false },
+  { "CloseCurlyQuote", "\xE2\x80\x99", false },
+  { "SuchThat", "\xE2\x88\x8B", false },
+  { "acy", "\xD0\xB0", false },
+  { "rect", "\xE2\x96\xAD", false },
+  { "incare", "\xE2\x84\x85", false },
+  { "lsquor", "\xE2\x80\x9A", false },
+  { "Oscr", "\xF0\x9D\x92\xAA", false },
+  { "", "", false },
+  { "searhk", "\xE2\xA4\xA5", false },
+  { "sqsube", "\xE2\x8A\x91", false },
+  { "rharu", "\xE2\x87\x80", false },
+  { "lparlt", "\xE2\xA6\x93", false },
+  { "Oslash", "\xC3\x98", true },
+  { "ograve", "\xC3\xB2", true },
+  { "eta", "\xCE\xB7", false },
+  { "gesdot", "\xE2\xAA\x80", false },
+  { "RightTriangleEqual", "\xE2\x8A\xB5", false },
+  { "rlhar", "\xE2\x87\x8C", false },
+  { "centerdot", "\xC2\xB7", false },
+  { "vee", "\xE2\x88\xA8", false },
+  { "blacksquare", "\xE2\x96\xAA", false },
+  { "sbquo", "\xE2\x80\x9A", false },
+  { "tshcy", "\xD1\x9B", false },
+  { "NotHumpEqual", "\xE2\x89\x8F\xCC\xB8", false },
+  { "intlarhk", "\xE2\xA8\x97", false },
+  { "", "", false },
+  { "", "", false },
+  { "Int", "\xE2\x88\xAC", false },
+  { "nwarr", "\xE2\x86\x96", false },
+  { "UpperLeftArrow", "\xE2\x86\x96", false },
+  { "kgreen", "\xC4\xB8", false },
+  { "sharp", "\xE2\x99\xAF", false },
+  { "lesdotor", "\xE2\xAA\x83", false },
+  { "dblac", "\xCB\x9D", false },
+  { "squ", "\xE2\x96\xA1", false },
+  { "subset", "\xE2\x8A\x82", false },
+  { "NotSucceeds", "\xE2\x8A\x81", false },
+  { "hslash", "\xE2\x84\x8F", false },
+  { "boxvr", "\xE2\x94\x9C", false },
+  { "spadesuit", "\xE2\x99\xA0", false },
+  { "or", "\xE2\x88\xA8", false },
+  { "blk34", "\xE2\x96\x93", false },
+  { "rarrsim", "\xE2\xA5\xB4", false },
+  { "plus", "\x2B", false },
+  { "itilde", "\xC4\xA9", false },
+  { "boxHU", "\xE2\x95\xA9", false },
+  { "lsim", "\xE2\x89\xB2", false },
+  { "", "", false },
+  { "Leftrightarrow", "\xE2\x87\x94", false },
+  { "csupe", "\xE2\xAB\x92", false },
+  { "zigrarr", "\xE2\x87\x9D", false },
+  { "trade", "\xE2\x84\xA2", false },
+  { "fopf", "\xF0\x9D\x95\x97", false },
+  { "nexists", "\xE2\x88\x84", false },
+  { "xwedge", "\xE2\x8B\x80", false },
+  { "Tfr", "\xF0\x9D\x94\x97", false },
+  { "fnof", "\xC6\x92", false },
+  { "OElig", "\xC5\x92", false },
+  { "lpar", "\x28", false },
+  { "cuwed", "\xE2\x8B\x8F", false },
+  { "middot", "\xC2\xB7", true },
+  { "Uopf", "\xF0\x9D\x95\x8C", false },
+  { "", "", false },
+  { "cupbrcap", "\xE2\xA9\x88", false },
+  { "vsubne", "\xE2\x8A\x8A\xEF\xB8\x80", false },
+  { "sext", "\xE2\x9C\xB6", false },
+  { "bump", "\xE2\x89\x8E", false },
+  { "SquareSubsetEqual", "\xE2\x8A\x91", false },
+  { "cuesc", "\xE2\x8B\x9F", false },
+  { "", "", false },
+  { "Lambda", "\xCE\x9B", false },
+  { "Uacute", "\xC3\x9A", true },
+  { "emsp13", "\xE2\x80\x84", false },
+  { "npolint", "\xE2\xA8\x94", false },
+  { "Precedes", "\xE2\x89\xBA", false },
+  { "MinusPlus", "\xE2\x88\x93", false },
+  { "", "", false },
+  { "demptyv", "\xE2\xA6\xB1", false },
+  { "thetasym", "\xCF\x91", false },
+  { "ShortLeftArrow", "\xE2\x86\x90", false },
+  { "nbumpe", "\xE2\x89\x8F\xCC\xB8", false },
+  { "dzcy", "\xD1\x9F", false },
+  { "vsupne", "\xE2\x8A\x8B\xEF\xB8\x80", false },
+  { "Lopf", "\xF0\x9D\x95\x83", false },
+  { "", "", false },
+  { "DownArrowBar", "\xE2\xA4\x93", false },
+  { "VerticalBar", "\xE2\x88\xA3", false },
+  { "seswar", "\xE2\xA4\xA9", false },
+  { "rang", "\xE2\x9F\xA9", false },
+  { "efDot", "\xE2\x89\x92", false },
+  { "NotLessEqual", "\xE2\x89\xB0", false },
+  { "notni", "\xE2\x88\x8C", false },
+  { "simdot", "\xE2\xA9\xAA", false },
+  { "notnivb", "\xE2\x8B\xBE", false },
+  { "", "", false },
+  { "sqsupseteq", "\xE2\x8A\x92", false },
+  { "subedot", "\xE2\xAB\x83", false },
+  { "roarr", "\xE2\x87\xBE", false },
+  { "gtrless", "\xE2\x89\xB7", false },
+  { "NotTildeTilde", "\xE2\x89\x89", false },
+  { "lessapprox", "\xE2\xAA\x85", false },
+  { "", "", false },
+  { "glj", "\xE2\xAA\xA4", false },
+  { "kfr", "\xF0\x9D\x94\xA8", false },
+  { "ropf", "\xF0\x9D\x95\xA3", false },
+  { "part", "\xE2\x88\x82", false },
+  { "Lsh", "\xE2\x86\xB0", false },
+  { "rightleftarrows", "\xE2\x87\x84", false },
+  { "nsube", "\xE2\x8A\x88", false },
+  { "hoarr", "\xE2\x87\xBF", false },
+  { "cupcap", "\xE2\xA9\x86", false },
+  { "ncong", "\xE2\x89\x87", false },
+  { "perp", "\xE2\x8A\xA5", false },
+  { "angrtvb", "\xE2\x8A\xBE", false },
+  { "Delta", "\xCE\x94", false },
+  { "NotSubset", "\xE2\x8A\x82\xE2\x83\x92", false },
+  { "xmap", "\xE2\x9F\xBC", false },
+  { "clubsuit", "\xE2\x99\xA3", false },
+  { "yopf", "\xF0\x9D\x95\xAA", false },
+  { "frac56", "\xE2\x85\x9A", false },
+  { "veebar", "\xE2\x8A\xBB", false },
+  { "utdot", "\xE2\x8B\xB0", false },
+  { "circledS", "\xE2\x93\x88", false },
+  { "ltcir", "\xE2\xA9\xB9", false },
+  { "DownLeftVectorBar", "\xE2\xA5\x96", false },
+  { "DifferentialD", "\xE2\x85\x86", false },
+  { "Integral", "\xE2\x88\xAB", false },
+  { "nsime", "\xE2\x89\x84", false },
+  { "Longrightarrow", "\xE2\x9F\xB9", false },
+  { "", "", false },
+  { "epsi", "\xCE\xB5", false },
+  { "lHar", "\xE2\xA5\xA2", false },
+  { "", "", false },
+  { "YIcy", "\xD0\x87", false },
+  { "ReverseUpEquilibrium", "\xE2\xA5\xAF", false },
+  { "Wopf", "\xF0\x9D\x95\x8E", false },
+  { "ltdot", "\xE2\x8B\x96", false },
+  { "rbrack", "\x5D", false },
+  { "qfr", "\xF0\x9D\x94\xAE", false },
+  { "ohm", "\xCE\xA9", false },
+  { "vsubnE", "\xE2\xAB\x8B\xEF\xB8\x80", false },
+  { "lharu", "\xE2\x86\xBC", false },
+  { "", "", false },
+  { "popf", "\xF0\x9D\x95\xA1", false },
+  { "leg", "\xE2\x8B\x9A", false },
+  { "ApplyFunction", "\xE2\x81\xA1", false },
+  { "", "", false },
+  { "DownRightVector", "\xE2\x87\x81", false },
+  { "boxDl", "\xE2\x95\x96", false },
+  { "expectation", "\xE2\x84\xB0", false },
+  { "NoBreak", "\xE2\x81\xA0", false },
+  { "cularr", "\xE2\x86\xB6", false },
+  { "boxvl", "\xE2\x94\xA4", false },
+  { "", "", false },
+  { "ngsim", "\xE2\x89\xB5", false },
+  { "hscr", "\xF0\x9D\x92\xBD", false },
+  { "", "", false },
+  { "otilde", "\xC3\xB5", true },
+  { "nvHarr", "\xE2\xA4\x84", false },
+  { "supsetneq", "\xE2\x8A\x8B", false },
+  { "lessdot", "\xE2\x8B\x96", false },
+  { "dcy", "\xD0\xB4", false },
+  { "cent", "\xC2\xA2", true },
+  { "ngeqslant", "\xE2\xA9\xBE\xCC\xB8", false },
+  { "gnsim", "\xE2\x8B\xA7", false },
+  { "gtrsim", "\xE2\x89\xB3", false },
+  { "supnE", "\xE2\xAB\x8C", false },
+  { "scap", "\xE2\xAA\xB8", false },
+  { "prop", "\xE2\x88\x9D", false },
+  { "harrcir", "\xE2\xA5\x88", false },
+  { "spades", "\xE2\x99\xA0", false },
+  { "checkmark", "\xE2\x9C\x93", false },
+  { "Zcaron", "\xC5\xBD", false },
+  { "bottom", "\xE2\x8A\xA5", false },
+  { "lobrk", "\xE2\x9F\xA6", false },
+};
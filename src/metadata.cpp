@@ -154,6 +154,25 @@ Metadata::Errors concat(Metadata::Errors e1, const Metadata::Errors& e2)
   return e1;
 }
 
+// Parses the value of the Counter metadata. Returns false if it doesn't
+// follow the "mimetype=count;..." format.
+bool parseCounter(const std::string& value, Metadata::MimeTypeCounter& counter)
+{
+  std::istringstream ss(value);
+  for ( std::string part; std::getline(ss, part, ';'); ) {
+    const auto eqPos = part.rfind('=');
+    if ( eqPos == std::string::npos || eqPos == 0 || eqPos + 1 == part.size() )
+      return false;
+
+    const std::string count = part.substr(eqPos + 1);
+    if ( count.size() > 18 || count.find_first_not_of("0123456789") != std::string::npos )
+      return false;
+
+    counter[part.substr(0, eqPos)] += std::stoull(count);
+  }
+  return true;
+}
+
 } // unnamed namespace
 
 const Metadata::ReservedMetadataTable& Metadata::reservedMetadataInfo = reservedMetadataInfoTable;
@@ -210,12 +229,15 @@ Metadata::Errors Metadata::checkSimpleConstraints() const
     const auto& mimetype = nv.second.mimeType;
     try {
       const auto& rmr = getReservedMetadataRecord(name);
-      if ( rmr.minLength != 0 && getTextLength(value) < rmr.minLength ) {
+      const size_t length = (rmr.minLength != 0 || rmr.maxLength != 0)
+                          ? getTextLength(value)
+                          : 0;
+      if ( rmr.minLength != 0 && length < rmr.minLength ) {
         std::ostringstream oss;
         oss << name << " must contain at least " << rmr.minLength << " characters";
         errors.push_back(oss.str());
       }
-      if ( rmr.maxLength != 0 && getTextLength(value) > rmr.maxLength ) {
+      if ( rmr.maxLength != 0 && length > rmr.maxLength ) {
         std::ostringstream oss;
         oss << name << " must contain at most " << rmr.maxLength << " characters";
         errors.push_back(oss.str());
@@ -256,4 +278,30 @@ Metadata::Errors Metadata::check() const
   return checkComplexConstraints();
 }
 
+Metadata::Errors Metadata::checkCounter(const MimeTypeCounter& actualCounts) const
+{
+  MimeTypeCounter declaredCounts;
+  const auto it = data.find("Counter");
+  if ( it == data.end() || !parseCounter(it->second.value, declaredCounts) )
+    return {}; // a malformed Counter is reported by check()
+
+  // Every MIME type present on either side is compared
+  MimeTypeCounter allMimeTypes(declaredCounts);
+  allMimeTypes.insert(actualCounts.begin(), actualCounts.end());
+
+  Errors errors;
+  for ( const auto& kv : allMimeTypes ) {
+    const auto& mimeType = kv.first;
+    const auto declared = declaredCounts.count(mimeType) ? declaredCounts.at(mimeType) : 0;
+    const auto actual = actualCounts.count(mimeType) ? actualCounts.at(mimeType) : 0;
+    if ( declared != actual ) {
+      std::ostringstream oss;
+      oss << "Counter declares " << declared << " " << mimeType
+          << " item(s) while the archive contains " << actual;
+      errors.push_back(oss.str());
+    }
+  }
+  return errors;
+}
+
 } // namespace zim
@@ -55,6 +55,9 @@ public: // types
 
   typedef std::vector<std::string> Errors;
 
+  // Number of items by MIME type
+  typedef std::map<std::string, size_t> MimeTypeCounter;
+
   typedef KeyValueMap::const_iterator Iterator;
 
 public: // data
@@ -68,6 +71,10 @@ public: // functions
   bool valid() const;
   Errors check() const;
 
+  // Compares the Counter metadata (if present and well-formed) with the
+  // actual counts of items in the archive
+  Errors checkCounter(const MimeTypeCounter& actualCounts) const;
+
   static const ReservedMetadataRecord& getReservedMetadataRecord(const std::string& name);
 
   Iterator begin() const { return data.begin(); }
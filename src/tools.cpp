@@ -33,9 +33,24 @@
 #include <algorithm>
 #include <regex>
 #include <array>
+#include <atomic>
 #include <unicode/brkiter.h>
 #include <unicode/utypes.h>
 #include <unicode/unistr.h>
+#include <unicode/utext.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// The vectorized base64 loops need SSSE3 (for pshufb), which isn't part of
+// the x86-64 baseline: they are compiled for it and used if the CPU
+// supports it.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define VECTORIZED_BASE64
+#define TARGET_SSSE3 __attribute__((target("ssse3")))
+#include <tmmintrin.h>
+#endif
 
 #ifdef _WIN32
 #define SEPARATOR "\\"
@@ -84,138 +99,375 @@ std::string getFileExtension(std::string_view path) {
 }
 
 /* base64 */
-static const std::string base64_chars
-    = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-      "abcdefghijklmnopqrstuvwxyz"
-      "0123456789+/";
+namespace
+{
+
+const char base64_chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                            "abcdefghijklmnopqrstuvwxyz"
+                            "0123456789+/";
+
+const uint8_t INVALID_BASE64_CHAR = 0xFF;
+
+constexpr std::array<uint8_t, 256> makeBase64DecodingTable()
+{
+  std::array<uint8_t, 256> table{};
+  for (int c = 0; c < 256; ++c) {
+    table[c] = (c >= 'A' && c <= 'Z') ? c - 'A'
+             : (c >= 'a' && c <= 'z') ? c - 'a' + 26
+             : (c >= '0' && c <= '9') ? c - '0' + 52
+             : c == '+' ? 62
+             : c == '/' ? 63
+             : INVALID_BASE64_CHAR;
+  }
+  return table;
+}
+
+constexpr std::array<uint8_t, 256> base64DecodingTable = makeBase64DecodingTable();
+
+#ifdef VECTORIZED_BASE64
+// The SSSE3 versions of the base64 encoding and decoding loops follow
+// W. Muła and D. Lemire, "Faster Base64 Encoding and Decoding Using AVX2
+// Instructions" (ACM TOW 2018).
+
+// Encodes the first 12 bytes of in (which must be readable up to 16 bytes)
+// into 16 base64 characters
+TARGET_SSSE3 inline __m128i base64EncodeBlock(__m128i in)
+{
+  // Distribute the 4 groups of 6 bits of every 3 bytes into 4 bytes
+  in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+  const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+  const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+  const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+  const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+  const __m128i indices = _mm_or_si128(t1, t3);
+
+  // Translate the 6-bit values into characters by adding an offset
+  // depending on the range of the value
+  const __m128i offsets = _mm_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0);
+  __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+  range = _mm_sub_epi8(range, _mm_cmpgt_epi8(indices, _mm_set1_epi8(25)));
+  return _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, range));
+}
+
+// Decodes 16 base64 characters into the first 12 bytes of out. Returns
+// false (without decoding anything) if one of the characters is invalid.
+TARGET_SSSE3 inline bool base64DecodeBlock(__m128i in, __m128i& out)
+{
+  const __m128i mask2F = _mm_set1_epi8(0x2F);
+  const __m128i lutLo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                      0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+  const __m128i lutHi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                      0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+  const __m128i lutRoll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71,
+                                        0, 0, 0, 0, 0, 0, 0, 0);
+
+  const __m128i hiNibbles = _mm_and_si128(_mm_srli_epi32(in, 4), mask2F);
+  const __m128i loNibbles = _mm_and_si128(in, mask2F);
+  const __m128i hi = _mm_shuffle_epi8(lutHi, hiNibbles);
+  const __m128i lo = _mm_shuffle_epi8(lutLo, loNibbles);
+  if ( _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128())) != 0 )
+    return false;
+
+  const __m128i eq2F = _mm_cmpeq_epi8(in, mask2F);
+  const __m128i roll = _mm_shuffle_epi8(lutRoll, _mm_add_epi8(eq2F, hiNibbles));
+  const __m128i values = _mm_add_epi8(in, roll);
+
+  // Pack the 16 6-bit values into 12 bytes
+  const __m128i mergedPairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+  const __m128i merged = _mm_madd_epi16(mergedPairs, _mm_set1_epi32(0x00011000));
+  out = _mm_shuffle_epi8(merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+  return true;
+}
+
+// Encodes the data 12 bytes at a time as long as 16 bytes can be read,
+// advancing in and out
+TARGET_SSSE3 void base64EncodeBlocks(const unsigned char*& in, const unsigned char* end, char*& out)
+{
+  for ( ; end - in >= 16; in += 12, out += 16 ) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), base64EncodeBlock(block));
+  }
+}
+
+// Decodes the data 16 characters at a time (writing 16 bytes for every
+// 12 decoded ones), advancing in and out. Returns false if an invalid
+// character is found.
+TARGET_SSSE3 bool base64DecodeBlocks(const unsigned char*& in, const unsigned char* end, unsigned char*& out)
+{
+  for ( ; end - in >= 16; in += 16, out += 12 ) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+    __m128i bytes;
+    if ( !base64DecodeBlock(block, bytes) )
+      return false;
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), bytes);
+  }
+  return true;
+}
+
+bool cpuSupportsSsse3()
+{
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("ssse3");
+}
+
+const bool ssse3Supported = cpuSupportsSsse3();
+std::atomic<bool> vectorizedBase64(ssse3Supported);
+#endif
+
+bool isAsciiWhitespace(char c)
+{
+  return c == ' ' || c == '\t' || c == '\n' || c == '\f' || c == '\r';
+}
+
+} // unnamed namespace
+
+std::string base64_encode(std::string_view data)
+{
+  const unsigned char* in = reinterpret_cast<const unsigned char*>(data.data());
+  const unsigned char* const end = in + data.size();
+  std::string ret((data.size() + 2) / 3 * 4, '\0');
+  char* out = &ret[0];
+
+#ifdef VECTORIZED_BASE64
+  if ( vectorizedBase64.load(std::memory_order_relaxed) )
+    base64EncodeBlocks(in, end, out);
+#endif
+
+  for ( ; end - in >= 3; in += 3, out += 4 ) {
+    const uint32_t v = (uint32_t(in[0]) << 16) | (uint32_t(in[1]) << 8) | in[2];
+    out[0] = base64_chars[v >> 18];
+    out[1] = base64_chars[(v >> 12) & 0x3F];
+    out[2] = base64_chars[(v >> 6) & 0x3F];
+    out[3] = base64_chars[v & 0x3F];
+  }
+
+  if ( in != end ) {
+    const uint32_t v = (uint32_t(in[0]) << 16) | (end - in == 2 ? uint32_t(in[1]) << 8 : 0);
+    out[0] = base64_chars[v >> 18];
+    out[1] = base64_chars[(v >> 12) & 0x3F];
+    out[2] = end - in == 2 ? base64_chars[(v >> 6) & 0x3F] : '=';
+    out[3] = '=';
+  }
+
+  return ret;
+}
 
 std::string base64_encode(unsigned char const* bytes_to_encode,
                           unsigned int in_len)
 {
-  std::string ret;
-  int i = 0;
-  int j = 0;
-  unsigned char char_array_3[3];
-  unsigned char char_array_4[4];
+  return base64_encode(std::string_view(reinterpret_cast<const char*>(bytes_to_encode), in_len));
+}
 
-  while (in_len--) {
-    char_array_3[i++] = *(bytes_to_encode++);
-    if (i == 3) {
-      char_array_4[0] = (char_array_3[0] & 0xfc) >> 2;
-      char_array_4[1]
-          = ((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xf0) >> 4);
-      char_array_4[2]
-          = ((char_array_3[1] & 0x0f) << 2) + ((char_array_3[2] & 0xc0) >> 6);
-      char_array_4[3] = char_array_3[2] & 0x3f;
+namespace
+{
 
-      for (i = 0; (i < 4); i++)
-        ret += base64_chars[char_array_4[i]];
-      i = 0;
-    }
+// Same as base64_decode() but without skipping whitespace
+bool decodeBase64WithoutWhitespace(std::string_view encoded, std::string& decoded)
+{
+  if ( encoded.size() % 4 == 0 ) {
+    for ( int i = 0; i < 2 && !encoded.empty() && encoded.back() == '='; ++i )
+      encoded.remove_suffix(1);
   }
+  if ( encoded.size() % 4 == 1 )
+    return false;
 
-  if (i) {
-    for (j = i; j < 3; j++)
-      char_array_3[j] = '\0';
+  const size_t decodedSize = encoded.size() / 4 * 3 + (encoded.size() % 4 == 0 ? 0 : encoded.size() % 4 - 1);
+  // The vectorized loop writes 4 bytes past the 12 decoded ones
+  decoded.resize(decodedSize + 4);
+  const unsigned char* in = reinterpret_cast<const unsigned char*>(encoded.data());
+  const unsigned char* const end = in + encoded.size();
+  unsigned char* out = reinterpret_cast<unsigned char*>(&decoded[0]);
 
-    char_array_4[0] = (char_array_3[0] & 0xfc) >> 2;
-    char_array_4[1]
-        = ((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xf0) >> 4);
-    char_array_4[2]
-        = ((char_array_3[1] & 0x0f) << 2) + ((char_array_3[2] & 0xc0) >> 6);
-    char_array_4[3] = char_array_3[2] & 0x3f;
+#ifdef VECTORIZED_BASE64
+  if ( vectorizedBase64.load(std::memory_order_relaxed) && !base64DecodeBlocks(in, end, out) )
+    return false;
+#endif
 
-    for (j = 0; (j < i + 1); j++)
-      ret += base64_chars[char_array_4[j]];
+  const auto& t = base64DecodingTable;
+  for ( ; end - in >= 4; in += 4, out += 3 ) {
+    const uint32_t a = t[in[0]], b = t[in[1]], c = t[in[2]], d = t[in[3]];
+    if ( (a | b | c | d) & 0xC0 ) // INVALID_BASE64_CHAR
+      return false;
+    const uint32_t v = (a << 18) | (b << 12) | (c << 6) | d;
+    out[0] = v >> 16;
+    out[1] = v >> 8;
+    out[2] = v;
+  }
 
-    while ((i++ < 3))
-      ret += '=';
+  if ( in != end ) {
+    // 2 or 3 characters left (the bits that don't make a full byte are
+    // discarded)
+    const uint32_t a = t[in[0]], b = t[in[1]], c = end - in == 3 ? t[in[2]] : 0;
+    if ( (a | b | c) & 0xC0 ) // INVALID_BASE64_CHAR
+      return false;
+    const uint32_t v = (a << 18) | (b << 12) | (c << 6);
+    *out++ = v >> 16;
+    if ( end - in == 3 )
+      *out++ = v >> 8;
   }
 
-  return ret;
+  decoded.resize(decodedSize);
+  return true;
 }
 
-static char charFromHex(std::string a)
+} // unnamed namespace
+
+bool useVectorizedBase64(bool enabled)
 {
-  std::istringstream Blat(a);
-  int Z;
-  Blat >> std::hex >> Z;
-  return char(Z);
+#ifdef VECTORIZED_BASE64
+  vectorizedBase64 = enabled && ssse3Supported;
+  return vectorizedBase64;
+#else
+  return false;
+#endif
 }
 
-std::string decodeUrl(const std::string& originalUrl)
+bool base64_decode(std::string_view encoded, std::string& decoded)
 {
-  std::string url = originalUrl;
-  std::string::size_type pos = 0;
-  while ((pos = url.find('%', pos)) != std::string::npos
-         && pos + 2 < url.length()) {
-    if (!isxdigit(url[pos+1]) || !isxdigit(url[pos+2])) {
-      ++pos;
-      continue;
-    }
-    url.replace(pos, 3, 1, charFromHex(url.substr(pos + 1, 2)));
-    ++pos;
+  if ( decodeBase64WithoutWhitespace(encoded, decoded) )
+    return true;
+
+  // Whitespace is rare, so it is only looked for when decoding fails
+  if ( std::none_of(encoded.begin(), encoded.end(), isAsciiWhitespace) )
+    return false;
+
+  std::string stripped;
+  stripped.reserve(encoded.size());
+  std::copy_if(encoded.begin(), encoded.end(), std::back_inserter(stripped),
+               [](char c) { return !isAsciiWhitespace(c); });
+  return decodeBase64WithoutWhitespace(stripped, decoded);
+}
+
+namespace
+{
+
+constexpr std::array<int8_t, 256> makeHexDigitTable()
+{
+  std::array<int8_t, 256> table{};
+  for (int c = 0; c < 256; ++c) {
+    table[c] = (c >= '0' && c <= '9') ? c - '0'
+             : (c >= 'a' && c <= 'f') ? c - 'a' + 10
+             : (c >= 'A' && c <= 'F') ? c - 'A' + 10
+             : -1;
   }
-  return url;
+  return table;
 }
 
-static std::string removeLastPathElement(const std::string& path,
-                                  const bool removePreSeparator,
-                                  const bool removePostSeparator)
+constexpr std::array<int8_t, 256> hexDigitTable = makeHexDigitTable();
+
+// Returns the value of the hexadecimal digit c or -1 if c is not a hex digit
+inline int hexDigitValue(char c)
 {
-  std::string newPath = path;
-  size_t offset = newPath.find_last_of(SEPARATOR);
+  return hexDigitTable[static_cast<unsigned char>(c)];
+}
 
-  if (removePreSeparator && offset == newPath.length() - 1) {
-    newPath = newPath.substr(0, offset);
-    offset = newPath.find_last_of(SEPARATOR);
+// Decodes the percent-escape at p (if it is a valid one) into c and returns
+// the number of characters consumed
+inline size_t decodePercentEscape(const char* p, const char* end, char& c)
+{
+  if (end - p > 2) {
+    const int hi = hexDigitValue(p[1]);
+    const int lo = hexDigitValue(p[2]);
+    if (hi >= 0 && lo >= 0) {
+      c = char(hi * 16 + lo);
+      return 3;
+    }
   }
-  newPath = removePostSeparator ? newPath.substr(0, offset)
-                                : newPath.substr(0, offset + 1);
+  c = '%';
+  return 1;
+}
 
-  return newPath;
+} // unnamed namespace
+
+std::string decodeUrl(std::string_view url)
+{
+  const char* p = url.data();
+  const char* const end = p + url.size();
+  const char* escape = static_cast<const char*>(memchr(p, '%', url.size()));
+  if (escape == nullptr) {
+    // Fast path: memchr() is vectorised by the C library
+    return std::string(url);
+  }
+
+  std::string decoded;
+  decoded.reserve(url.size());
+  while (escape != nullptr) {
+    decoded.append(p, escape);
+    char c;
+    p = escape + decodePercentEscape(escape, end, c);
+    decoded += c;
+    escape = static_cast<const char*>(memchr(p, '%', end - p));
+  }
+  decoded.append(p, end);
+  return decoded;
 }
 
 namespace
 {
 
-std::vector<std::string> split(const std::string & str, char delim)
+// Length of the parent of path (including the trailing separator)
+size_t parentPathLength(std::string_view path)
 {
-  std::vector<std::string> result;
-  auto start = str.begin();
-  while ( true ) {
-      const auto end = find(start, str.end(), delim);
+  return path.find_last_of(SEPARATOR) + 1; // npos + 1 == 0
+}
 
-      result.push_back(std::string(start, end));
-      if ( end == str.end() )
-        break;
-      start = end + 1;
+// Calls f on each '/'-separated segment of path (including empty ones)
+template<class F>
+void forEachPathSegment(std::string_view path, F f)
+{
+  while ( true ) {
+    const size_t end = path.find('/');
+    f(path.substr(0, end));
+    if ( end == std::string_view::npos )
+      break;
+    path.remove_prefix(end + 1);
   }
+}
 
-  return result;
+size_t countPathSegments(std::string_view path)
+{
+  return std::count(path.begin(), path.end(), '/') + 1;
 }
 
-std::string
-getRelativePath(const std::string& basePath, const std::string& targetPath)
+// Appends a path segment to r (adding a separator if needed)
+void appendPathSegment(std::string& r, std::string_view segment)
 {
-    const auto b = split(basePath, '/');
-    const auto t = split(targetPath, '/');
-    const auto l = std::min(b.size()-1, t.size());
+  if ( !r.empty() && r.back() != '/' )
+    r += '/';
+  r += segment;
+}
 
-    auto x = mismatch(b.begin(), b.begin() + l, t.begin());
+std::string
+getRelativePath(std::string_view basePath, std::string_view targetPath)
+{
+    const size_t baseSegmentCount = countPathSegments(basePath);
+    const size_t targetSegmentCount = countPathSegments(targetPath);
+    const size_t l = std::min(baseSegmentCount - 1, targetSegmentCount);
+
+    // Count the common leading segments (leaving the common ones out of
+    // targetPath)
+    size_t common = 0;
+    while ( common < l ) {
+      const size_t b = basePath.find('/');
+      const size_t t = targetPath.find('/');
+      if ( basePath.substr(0, b) != targetPath.substr(0, t) )
+        break;
+      basePath.remove_prefix(b + 1);
+      targetPath.remove_prefix(t == std::string_view::npos ? targetPath.size() : t + 1);
+      ++common;
+    }
 
-    const size_t ups = (b.end() - x.first) + (x.second == t.end());
+    const size_t ups = (baseSegmentCount - common) + (common == targetSegmentCount);
     std::string r;
+    r.reserve(3 * ups + targetPath.size());
     for ( size_t i = 1; i < ups; ++i ) {
-      if ( !r.empty() && r.back() != '/' )
-        r += "/";
-      r += "..";
+      appendPathSegment(r, "..");
     }
 
-    for ( auto it = x.second; it != t.end(); ++it ) {
-        if ( !r.empty() && r.back() != '/' )
-          r += "/";
-        r += *it;
+    if ( common != targetSegmentCount ) {
+      forEachPathSegment(targetPath, [&r](std::string_view segment) {
+        appendPathSegment(r, segment);
+      });
     }
     return r;
 }
@@ -223,44 +475,51 @@ getRelativePath(const std::string& basePath, const std::string& targetPath)
 } // unnamed namespace
 
 std::string
-computeRelativePath(const std::string& basePath, const std::string& targetPath)
+computeRelativePath(std::string_view basePath, std::string_view targetPath)
 {
-  if ( targetPath.back() == '/' ) {
+  if ( !targetPath.empty() && targetPath.back() == '/' ) {
     if ( basePath == targetPath )
       return "./";
 
-    const std::string strippedPath = targetPath.substr(0, targetPath.size()-1);
-    return getRelativePath(basePath, strippedPath) + '/';
+    targetPath.remove_suffix(1);
+    std::string r = getRelativePath(basePath, targetPath);
+    r += '/';
+    return r;
   }
   return getRelativePath(basePath, targetPath);
 }
 
 /* Warning: the relative path must be with slashes */
-std::string computeAbsolutePath(const std::string& path,
-                                const std::string& relativePath)
+std::string computeAbsolutePath(std::string_view path,
+                                std::string_view relativePath)
 {
+  std::string absolutePath;
+  absolutePath.reserve(path.size() + relativePath.size() + 1);
+
   /* Remove leaf part of the path if not already a directory */
-  std::string absolutePath = path.length()
-                               ? (path[path.length() - 1] == '/'
-                                  ? path
-                                  : removeLastPathElement(path, false, false))
-                               : path;
+  if ( !path.empty() && path.back() != '/' ) {
+    path = path.substr(0, parentPathLength(path));
+  }
+  absolutePath.assign(path.data(), path.size());
 
   /* Go through relative path */
-  std::vector<std::string> relativePathElements;
-  std::stringstream relativePathStream(relativePath);
-  std::string relativePathItem;
-  while (std::getline(relativePathStream, relativePathItem, '/')) {
-    if (relativePathItem == "..") {
-      absolutePath = removeLastPathElement(absolutePath, true, false);
-    } else if (!relativePathItem.empty() && relativePathItem != ".") {
-      absolutePath += relativePathItem;
-      absolutePath += "/";
+  forEachPathSegment(relativePath, [&absolutePath](std::string_view segment) {
+    if (segment == "..") {
+      if (!absolutePath.empty() && absolutePath.back() == SEPARATOR[0]) {
+        absolutePath.pop_back();
+      }
+      absolutePath.resize(parentPathLength(absolutePath));
+    } else if (!segment.empty() && segment != ".") {
+      absolutePath += segment;
+      absolutePath += '/';
     }
-  }
+  });
 
   /* Remove wront trailing / */
-  return absolutePath.substr(0, absolutePath.length() - 1);
+  if ( !absolutePath.empty() ) {
+    absolutePath.pop_back();
+  }
+  return absolutePath;
 }
 
 
@@ -290,6 +549,92 @@ void replaceStringInPlace(std::string& subject,
   return;
 }
 
+MultiStringReplacer::MultiStringReplacer(const Replacements& replacements)
+  : byteClass(),
+    classCount(1)
+{
+  for ( const auto& r : replacements ) {
+    for ( const char c : r.first ) {
+      uint16_t& cls = byteClass[static_cast<unsigned char>(c)];
+      if ( cls == 0 ) {
+        cls = classCount++;
+      }
+    }
+  }
+
+  transitions.assign(classCount, 0);
+  nodeReplacement.assign(1, -1);
+  for ( const auto& r : replacements ) {
+    if ( r.first.empty() )
+      continue;
+
+    uint32_t node = 0;
+    for ( const char c : r.first ) {
+      const size_t t = node * classCount + byteClass[static_cast<unsigned char>(c)];
+      if ( transitions[t] == 0 ) {
+        transitions[t] = nodeReplacement.size();
+        transitions.resize(transitions.size() + classCount, 0);
+        nodeReplacement.push_back(-1);
+      }
+      node = transitions[t];
+    }
+
+    // In case of duplicate patterns the first one wins
+    if ( nodeReplacement[node] < 0 ) {
+      nodeReplacement[node] = replacementStrings.size();
+      replacementStrings.push_back(r.second);
+    }
+  }
+}
+
+void MultiStringReplacer::replace(std::string_view text, std::string& result) const
+{
+  result.reserve(result.size() + text.size());
+  const uint32_t* const trans = transitions.data();
+  const uint16_t* const cls = byteClass.data();
+  const char* copiedUpTo = text.data();
+  const char* p = text.data();
+  const char* const end = p + text.size();
+  while ( true ) {
+    // Skip the bytes that can't start a pattern
+    while ( p != end && trans[cls[static_cast<unsigned char>(*p)]] == 0 )
+      ++p;
+    if ( p == end )
+      break;
+
+    // Find the longest pattern starting at p
+    int32_t replacement = -1;
+    const char* matchEnd = nullptr;
+    uint32_t node = 0;
+    for ( const char* q = p; q != end; ++q ) {
+      node = trans[node * classCount + cls[static_cast<unsigned char>(*q)]];
+      if ( node == 0 )
+        break;
+      if ( nodeReplacement[node] >= 0 ) {
+        replacement = nodeReplacement[node];
+        matchEnd = q + 1;
+      }
+    }
+
+    if ( replacement < 0 ) {
+      ++p;
+      continue;
+    }
+
+    result.append(copiedUpTo, p);
+    result += replacementStrings[replacement];
+    p = copiedUpTo = matchEnd;
+  }
+  result.append(copiedUpTo, end);
+}
+
+std::string MultiStringReplacer::replace(std::string_view text) const
+{
+  std::string result;
+  replace(text, result);
+  return result;
+}
+
 void stripTitleInvalidChars(std::string& str)
 {
   /* Remove unicode orientation invisible characters */
@@ -300,103 +645,218 @@ void stripTitleInvalidChars(std::string& str)
 namespace
 {
 
-const char* getHtmlEntity(const std::string& core)
+struct HtmlEntity
+{
+  const char* name;  // without the trailing ';'
+  const char* value;
+  bool semicolonIsOptional;
+};
+
+#include "html_entities.cpp"
+
+uint32_t htmlEntityHash(std::string_view name, uint32_t seed)
+{
+  // FNV-1a (must match gen_html_entities.py)
+  uint32_t h = 2166136261u ^ seed;
+  for ( const char c : name ) {
+    h ^= static_cast<unsigned char>(c);
+    h *= 16777619u;
+  }
+  return h;
+}
+
+const HtmlEntity* lookupHtmlEntity(std::string_view name)
+{
+  const uint32_t bucket = htmlEntityHash(name, 0) % HTML_ENTITY_BUCKET_COUNT;
+  const uint32_t slot = htmlEntityHash(name, htmlEntityDisplacements[bucket])
+                      % HTML_ENTITY_TABLE_SIZE;
+  const HtmlEntity& e = htmlEntityTable[slot];
+  return name == e.name ? &e : nullptr;
+}
+
+bool isAsciiAlnum(char c)
+{
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+}
+
+void appendUtf8(std::string& out, uint32_t codePoint)
+{
+  if ( codePoint < 0x80 ) {
+    out += char(codePoint);
+  } else if ( codePoint < 0x800 ) {
+    out += char(0xC0 | (codePoint >> 6));
+    out += char(0x80 | (codePoint & 0x3F));
+  } else if ( codePoint < 0x10000 ) {
+    out += char(0xE0 | (codePoint >> 12));
+    out += char(0x80 | ((codePoint >> 6) & 0x3F));
+    out += char(0x80 | (codePoint & 0x3F));
+  } else {
+    out += char(0xF0 | (codePoint >> 18));
+    out += char(0x80 | ((codePoint >> 12) & 0x3F));
+    out += char(0x80 | ((codePoint >> 6) & 0x3F));
+    out += char(0x80 | (codePoint & 0x3F));
+  }
+}
+
+// Code point of a numeric character reference after the adjustments of the
+// "numeric character reference end state" of the HTML tokenizer
+uint32_t fixNumericCharRef(uint32_t codePoint)
 {
-  static const std::map<std::string, const char*> t = {
-    { "amp",  "&"  },
-    { "apos", "'"  },
-    { "quot", "\"" },
-    { "lt",   "<"  },
-    { "gt",   ">"  },
+  // Code points 0x80-0x9F are interpreted as windows-1252 characters
+  static const uint16_t c1Replacements[32] = {
+    0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+    0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+    0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+    0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178,
   };
 
-  const auto it = t.find(core);
-  return it != t.end() ? it->second : nullptr;
+  if ( codePoint == 0 || codePoint > 0x10FFFF
+       || (codePoint >= 0xD800 && codePoint <= 0xDFFF) ) {
+    return 0xFFFD;
+  }
+  if ( codePoint >= 0x80 && codePoint <= 0x9F ) {
+    return c1Replacements[codePoint - 0x80];
+  }
+  return codePoint;
 }
 
-} // unnamed namespace
+// Decodes the numeric character reference at p (right after "&#").
+// Returns the end of the reference or nullptr if there is no reference.
+const char* decodeNumericCharRef(const char* p, const char* end, std::string& out)
+{
+  const bool hex = p != end && (*p == 'x' || *p == 'X');
+  const char* const digits = hex ? p + 1 : p;
+  uint32_t codePoint = 0;
+  const char* q = digits;
+  for ( ; q != end; ++q ) {
+    const int d = hexDigitValue(*q);
+    if ( d < 0 || d >= (hex ? 16 : 10) )
+      break;
+    // saturate, the exact value of out-of-range references doesn't matter
+    codePoint = std::min<uint32_t>(codePoint * (hex ? 16 : 10) + d, 0x110000);
+  }
 
-std::string decodeHtmlEntities(const std::string& str)
+  if ( q == digits )
+    return nullptr;
+
+  appendUtf8(out, fixNumericCharRef(codePoint));
+  return (q != end && *q == ';') ? q + 1 : q;
+}
+
+// Decodes the named character reference at p (right after "&") following
+// the rules of the "named character reference state" of the HTML tokenizer.
+// Returns the end of the reference or nullptr if it must be left as is.
+const char* decodeNamedCharRef(const char* p, const char* end, std::string& out,
+                               bool inAttributeValue)
 {
-  const char* p = str.c_str();
-  std::string result;
-  const char* start = nullptr;
-  for ( ; *p ; ++p ) {
-    if ( *p == '&' ) {
-      if ( start ) {
-        result.insert(result.end(), start, p);
-      }
-      start = p;
-    } else if ( !start ) {
-      result.push_back(*p);
-    } else if ( *p == ';' ) {
-      const char* d = getHtmlEntity(std::string(start+1, p));
-      if ( d ) {
-        result += d;
-      } else {
-        result.insert(result.end(), start, p+1);
+  const char* nameEnd = p;
+  while ( nameEnd != end && isAsciiAlnum(*nameEnd) )
+    ++nameEnd;
+
+  const std::string_view name(p, nameEnd - p);
+  if ( name.empty() )
+    return nullptr;
+
+  // The longest match is the full name followed by ';' ...
+  if ( nameEnd != end && *nameEnd == ';' && name.size() <= HTML_ENTITY_MAX_NAME_LENGTH ) {
+    if ( const HtmlEntity* e = lookupHtmlEntity(name) ) {
+      out += e->value;
+      return nameEnd + 1;
+    }
+  }
+
+  // ... otherwise a prefix of it that is a legacy name (usable without ';')
+  for ( size_t n = std::min(name.size(), HTML_ENTITY_MAX_LEGACY_NAME_LENGTH); n > 1; --n ) {
+    const HtmlEntity* e = lookupHtmlEntity(name.substr(0, n));
+    if ( e && e->semicolonIsOptional ) {
+      const char* const refEnd = p + n;
+      // For historical reasons "&copy=" or "&copyx" aren't decoded in
+      // attribute values (think of URL query strings)
+      if ( inAttributeValue && refEnd != end
+           && (*refEnd == '=' || isAsciiAlnum(*refEnd)) ) {
+        return nullptr;
       }
-      start = nullptr;
+      out += e->value;
+      return refEnd;
     }
   }
-  if ( start ) {
-    result.insert(result.end(), start, p);
+  return nullptr;
+}
+
+} // unnamed namespace
+
+void decodeHtmlEntities(std::string_view str, std::string& result, bool inAttributeValue)
+{
+  const char* p = str.data();
+  const char* const end = p + str.size();
+  while ( p != end ) {
+    const char* amp = static_cast<const char*>(memchr(p, '&', end - p));
+    if ( !amp ) {
+      result.append(p, end);
+      return;
+    }
+
+    result.append(p, amp);
+    const char* refStart = amp + 1;
+    const char* refEnd = (refStart != end && *refStart == '#')
+                       ? decodeNumericCharRef(refStart + 1, end, result)
+                       : decodeNamedCharRef(refStart, end, result, inAttributeValue);
+    if ( refEnd ) {
+      p = refEnd;
+    } else {
+      result += '&';
+      p = refStart;
+    }
   }
+}
+
+std::string decodeHtmlEntities(std::string_view str, bool inAttributeValue)
+{
+  std::string result;
+  if ( str.find('&') == std::string_view::npos )
+    return std::string(str);
+
+  result.reserve(str.size());
+  decodeHtmlEntities(str, result, inAttributeValue);
   return result;
 }
 
 namespace
 {
 
-const char* strSkipTillRightAfter(const char* p, const char* s)
+bool startsWith(const char* p, const char* end, std::string_view s)
 {
-    const int slen = strlen(s);
-    for ( ; *p ; ++p) {
-        if ( strncmp(p, s, slen) == 0 ) {
-            return p + slen;
-        }
-    }
-    return p;
+    return size_t(end - p) >= s.size() && memcmp(p, s.data(), s.size()) == 0;
+}
+
+const char* strSkipTillRightAfter(const char* p, const char* end, std::string_view s)
+{
+    const std::string_view text(p, end - p);
+    const size_t pos = text.find(s);
+    return pos == std::string_view::npos ? end : p + pos + s.size();
 }
 
-inline const char* skipWhitespace(const char* p)
+inline const char* skipWhitespace(const char* p, const char* end)
 {
-    while (*p == ' ')
+    while (p != end && *p == ' ')
         ++p;
 
     return p;
 }
 
-std::string getStringBeforeNext(const char* p, char c) {
-    const char* const s = p;
-    // XXX: don't run beyond end of string
-    while(*p != c)
-        p++;
-    return std::string(s, p);
-}
-
 } // unnamed namespace
 
-std::vector<html_link> generic_getLinks(const std::string& page)
+bool HtmlLinkScanner::next(html_link::AttributeKind& attribute, std::string_view& link)
 {
-    const char* p = page.c_str();
-    std::vector<html_link> links;
-
-    // The difference of the counts of the '<' and '>' characters preceding
-    // the current position. In a valid HTML without comments it should only
-    // take values 0 or 1.
-    int ltgtBalance = 0;
-    bool processingAScriptTag = false;
-
-    while (*p) {
+    while (p != end) {
         if ( *p == '<' ) {
-          if (strncmp(p, "<!--", 4) == 0) {
-            p = strSkipTillRightAfter(p, "-->");
+          if (startsWith(p, end, "<!--")) {
+            p = strSkipTillRightAfter(p, end, "-->");
             continue;
           }
           ++ltgtBalance;
           ++p;
-          if ( strncmp(p, "script", 6) == 0 && (p[6] == '>' || p[6] == ' ') ) {
+          if ( startsWith(p, end, "script") && end - p > 6 && (p[6] == '>' || p[6] == ' ') ) {
             processingAScriptTag = true;
             p += 6;
           }
@@ -405,7 +865,7 @@ std::vector<html_link> generic_getLinks(const std::string& page)
         if ( *p == '>' ) {
           --ltgtBalance;
           if ( processingAScriptTag ) {
-            p = strSkipTillRightAfter(p, "</script>");
+            p = strSkipTillRightAfter(p, end, "</script>");
             processingAScriptTag = false;
           } else {
             ++p;
@@ -418,34 +878,54 @@ std::vector<html_link> generic_getLinks(const std::string& page)
           continue;
         }
 
-        html_link::AttributeKind attr;
-        if (strncmp(p, " href", 5) == 0) {
-            attr = html_link::HREF;
+        if (startsWith(p, end, " href")) {
+            attribute = html_link::HREF;
             p += 5;
-        } else if (strncmp(p, " src", 4) == 0) {
-            attr = html_link::SRC;
+        } else if (startsWith(p, end, " src")) {
+            attribute = html_link::SRC;
             p += 4;
         } else {
             p += 1;
             continue;
         }
 
-        p = skipWhitespace(p);
+        p = skipWhitespace(p, end);
+        if (p == end)
+            break;
         if (*(p++) != '=')
             continue;
-        p = skipWhitespace(p);
+        p = skipWhitespace(p, end);
+        if (p == end)
+            break;
         const char delimiter = *p++;
         if (delimiter != '\'' && delimiter != '"')
             continue;
 
-        const auto link = getStringBeforeNext(p, delimiter);
-        links.push_back(html_link(attr, decodeHtmlEntities(link)));
-        p += link.size() + 1;
+        const char* const linkEnd = static_cast<const char*>(memchr(p, delimiter, end - p));
+        if (!linkEnd)
+            break;
+
+        link = std::string_view(p, linkEnd - p);
+        p = linkEnd + 1;
+        return true;
+    }
+    p = end;
+    return false;
+}
+
+std::vector<html_link> generic_getLinks(const std::string& page)
+{
+    std::vector<html_link> links;
+    HtmlLinkScanner scanner(page);
+    html_link::AttributeKind attr;
+    std::string_view link;
+    while (scanner.next(attr, link)) {
+        links.push_back(html_link(attr, decodeHtmlEntities(link, true)));
     }
     return links;
 }
 
-int adler32(const std::string& buf)
+int adler32(std::string_view buf)
 {
     unsigned int s1 = 1;
     unsigned int s2 = 0;
@@ -467,12 +947,11 @@ namespace
 // "abc"          -->  ""
 // "/abc"         -->  "/"
 // "/"            -->  "/"
-std::string getBasePath(const std::string& zimPath)
+// (stored in basePath, reusing its memory)
+void getBasePath(const std::string& zimPath, std::string& basePath)
 {
     const auto pos = zimPath.find_last_of('/');
-    return pos == std::string::npos
-         ? std::string()
-         : zimPath.substr(0, pos == 0 ? 1 : pos);
+    basePath.assign(zimPath, 0, pos == std::string::npos ? 0 : (pos == 0 ? 1 : pos));
 }
 
 bool dropLastSegmentOfThePath(std::string& path)
@@ -503,61 +982,170 @@ const char* getPathSeparatorFor(const std::string& path)
     return path.empty() || path == "/" ? "" : "/";
 }
 
-void stripFragmentAndOrSearchComponent(std::string& url)
+// strip the fragment and/or search components, if any
+std::string_view stripFragmentAndOrSearchComponent(std::string_view url)
 {
-    // strip the fragment and/or search components, if any
-    auto endOfPathComponent = url.find_last_of("#?");
-    if ( endOfPathComponent != std::string::npos ) {
-      url.resize(endOfPathComponent);
+    return url.substr(0, url.find_last_of("#?"));
+}
+
+// Appends to out the percent-decoded characters of url starting at p up to
+// the next (decoded) '/' and returns the position right after it (nullptr
+// for the last segment).
+const char* appendDecodedSegment(const char* p, const char* end, std::string& out)
+{
+    while ( p < end ) {
+        char c = *p;
+        p += ( c == '%' ) ? decodePercentEscape(p, end, c) : 1;
+        if ( c == '/' )
+            return p;
+        out += c;
     }
+    return nullptr;
 }
 
 } // unnamed namespace
 
 InternalLinkResolver::InternalLinkResolver(const std::string& zimPath)
-: zimEntryPath(zimPath)
-, basePath(getBasePath(zimPath))
 {
+    setZimPath(zimPath);
+}
+
+void InternalLinkResolver::setZimPath(const std::string& zimPath)
+{
+    zimEntryPath = zimPath;
+    getBasePath(zimPath, basePath);
 }
 
 std::string InternalLinkResolver::resolveLinkTarget(std::string url) const
 {
-    stripFragmentAndOrSearchComponent(url);
+    std::string resolvedPath;
+    resolveLinkTarget(url, resolvedPath);
+    return resolvedPath;
+}
+
+void InternalLinkResolver::resolveLinkTarget(std::string_view url, std::string& resolvedPath) const
+{
+    url = stripFragmentAndOrSearchComponent(url);
     if (url.empty()) {
-      return zimEntryPath;
+      resolvedPath = zimEntryPath;
+      return;
     }
 
     if ( url.front() == '/' ) {
-      throw AbsolutePathURL(url);
+      throw AbsolutePathURL(std::string(url));
     }
 
-    url = decodeUrl(url);
-
-    std::string resolvedPath = basePath;
+    // The segments are percent-decoded directly into resolvedPath and
+    // dropped from it if they turn out to be "." or ".."
+    resolvedPath = basePath;
     const char* pathTerminator = "";
     const char* pathSeparator  = getPathSeparatorFor(resolvedPath);
     const char* const urlEnd = url.data() + url.size();
-    for (const char* segStart = url.data(); segStart <= urlEnd; ) {
-      const char* const segEnd = std::find(segStart, urlEnd, '/');
-      const std::string_view p(segStart, segEnd - segStart);
-      segStart = segEnd + 1;
+    for (const char* segStart = url.data(); segStart != nullptr; ) {
+      const size_t prevSize = resolvedPath.size();
+      resolvedPath += pathSeparator;
+      const size_t segOffset = resolvedPath.size();
+      segStart = appendDecodedSegment(segStart, urlEnd, resolvedPath);
+      const std::string_view p(resolvedPath.data() + segOffset, resolvedPath.size() - segOffset);
       if ( p == ".") {
+        resolvedPath.resize(prevSize);
         pathSeparator = pathTerminator = getPathSeparatorFor(resolvedPath);
-        continue;
       } else if ( p == ".." ) {
+        resolvedPath.resize(prevSize);
         if ( !dropLastSegmentOfThePath(resolvedPath) ) {
-          throw OutOfBoundsURL(url);
+          throw OutOfBoundsURL(decodeUrl(url));
         }
         pathSeparator = pathTerminator = getPathSeparatorFor(resolvedPath);
       } else {
-        resolvedPath += pathSeparator;
-        resolvedPath += p;
         pathTerminator = "";
         pathSeparator  = "/";
       }
     }
 
-    return resolvedPath + pathTerminator;
+    resolvedPath += pathTerminator;
+}
+
+namespace
+{
+
+const LinkTargetBatch::TargetId NO_TARGET = LinkTargetBatch::TargetId(-1);
+
+} // unnamed namespace
+
+void LinkTargetBatch::clear()
+{
+    // Only the slots used by the page are emptied
+    for (const auto& t : targetVector)
+        hashTable[t.slot] = NO_TARGET;
+    targetData.clear();
+    targetVector.clear();
+    linkVector.clear();
+}
+
+void LinkTargetBatch::add(const InternalLinkResolver& resolver, std::string_view url, size_t id)
+{
+    resolver.resolveLinkTarget(url, resolvedPath);
+    linkVector.push_back(Link{intern(resolvedPath), id});
+}
+
+LinkTargetBatch::TargetId LinkTargetBatch::intern(std::string_view s)
+{
+    // At most half full
+    if (2 * (targetVector.size() + 1) > hashTable.size())
+        growHashTable();
+
+    const size_t mask = hashTable.size() - 1;
+    size_t slot = std::hash<std::string_view>()(s) & mask;
+    for (; hashTable[slot] != NO_TARGET; slot = (slot + 1) & mask) {
+        if (target(hashTable[slot]) == s)
+            return hashTable[slot];
+    }
+
+    const TargetId id = targetVector.size();
+    hashTable[slot] = id;
+    targetVector.push_back(Target{targetData.size(), s.size(), slot});
+    targetData += s;
+    return id;
+}
+
+void LinkTargetBatch::growHashTable()
+{
+    hashTable.assign(std::max<size_t>(64, 2 * hashTable.size()), NO_TARGET);
+    const size_t mask = hashTable.size() - 1;
+    for (TargetId id = 0; id < targetVector.size(); ++id) {
+        size_t slot = std::hash<std::string_view>()(target(id)) & mask;
+        while (hashTable[slot] != NO_TARGET)
+            slot = (slot + 1) & mask;
+        hashTable[slot] = id;
+        targetVector[id].slot = slot;
+    }
+}
+
+void LinkTargetBatch::sortByTarget()
+{
+    // The distinct targets are sorted (rather than the links, which may
+    // share them)
+    order.resize(targetVector.size());
+    for (TargetId id = 0; id < order.size(); ++id)
+        order[id] = id;
+    std::sort(order.begin(), order.end(), [this](TargetId a, TargetId b) {
+        return target(a) < target(b);
+    });
+
+    // order[newId] = oldId: renumber the targets and their slots
+    sortedTargets.clear();
+    for (TargetId newId = 0; newId < order.size(); ++newId) {
+        sortedTargets.push_back(targetVector[order[newId]]);
+        hashTable[sortedTargets.back().slot] = newId;
+    }
+    // The links are renumbered using the hash table (slot -> new id)
+    for (auto& l : linkVector)
+        l.target = hashTable[targetVector[l.target].slot];
+    targetVector.swap(sortedTargets);
+
+    std::sort(linkVector.begin(), linkVector.end(), [](const Link& a, const Link& b) {
+        return a.target < b.target || (a.target == b.target && a.id < b.id);
+    });
 }
 
 std::string resolveLinkTarget(std::string url, const std::string& zimPath) {
@@ -579,7 +1167,7 @@ bool isAsciiAlphaNumeric(const char c)
     return isAsciiAlpha(c) || (c >= '0' && c <= '9');
 }
 
-bool isValidUriScheme(const std::string& scheme)
+bool isValidUriScheme(std::string_view scheme)
 {
     if (scheme.empty() || !isAsciiAlpha(scheme.front())) {
         return false;
@@ -591,24 +1179,42 @@ bool isValidUriScheme(const std::string& scheme)
         [](const char c) { return isAsciiAlphaNumeric(c) || c == '+' || c == '-' || c == '.'; });
 }
 
-UriKind specialUriSchemeKind(const std::string& s)
+// Compares s with the lowercase ASCII string lowercaseStr ignoring the case
+// of the letters of s
+bool equalsIgnoringAsciiCase(std::string_view s, std::string_view lowercaseStr)
 {
-    static const std::map<std::string, UriKind> uriSchemes = {
-        { "javascript", UriKind::JAVASCRIPT },
-        { "mailto",     UriKind::MAILTO     },
-        { "tel",        UriKind::TEL        },
-        { "sip",        UriKind::SIP        },
-        { "geo",        UriKind::GEO        },
-        { "data",       UriKind::DATA       },
-        { "xmpp",       UriKind::XMPP       },
-        { "news",       UriKind::NEWS       },
-        { "urn",        UriKind::URN        }
-    };
+    return s.size() == lowercaseStr.size()
+        && std::equal(s.begin(), s.end(), lowercaseStr.begin(),
+                      [](char a, char b) { return (isAsciiAlpha(a) ? a | 0x20 : a) == b; });
+}
 
-    const auto it = uriSchemes.find(s);
-    return it != uriSchemes.end() ? it->second : UriKind::GENERIC_URI;
+constexpr unsigned uriSchemeKey(size_t length, char lowercaseFirstLetter)
+{
+    return length * 256 + static_cast<unsigned char>(lowercaseFirstLetter);
 }
 
+// scheme must be a valid URI scheme
+UriKind specialUriSchemeKind(std::string_view scheme)
+{
+    // The special schemes are told apart by their length and first letter,
+    // so that at most one (allocation-free) comparison is needed
+    const auto kindIf = [scheme](std::string_view name, UriKind kind) {
+        return equalsIgnoringAsciiCase(scheme, name) ? kind : UriKind::GENERIC_URI;
+    };
+
+    switch ( uriSchemeKey(scheme.size(), scheme.front() | 0x20) ) {
+        case uriSchemeKey(10, 'j'): return kindIf("javascript", UriKind::JAVASCRIPT);
+        case uriSchemeKey(6, 'm'):  return kindIf("mailto",     UriKind::MAILTO);
+        case uriSchemeKey(3, 't'):  return kindIf("tel",        UriKind::TEL);
+        case uriSchemeKey(3, 's'):  return kindIf("sip",        UriKind::SIP);
+        case uriSchemeKey(3, 'g'):  return kindIf("geo",        UriKind::GEO);
+        case uriSchemeKey(4, 'd'):  return kindIf("data",       UriKind::DATA);
+        case uriSchemeKey(4, 'x'):  return kindIf("xmpp",       UriKind::XMPP);
+        case uriSchemeKey(4, 'n'):  return kindIf("news",       UriKind::NEWS);
+        case uriSchemeKey(3, 'u'):  return kindIf("urn",        UriKind::URN);
+        default:                    return UriKind::GENERIC_URI;
+    }
+}
 
 } // unnamed namespace
 
@@ -622,8 +1228,8 @@ UriKind html_link::detectUriKind(std::string_view input_string)
             return UriKind::OTHER;
     }
 
-    const std::string raw_scheme(input_string.substr(0, k));
-    if (!isValidUriScheme(raw_scheme)) {
+    const std::string_view scheme = input_string.substr(0, k);
+    if (!isValidUriScheme(scheme)) {
         return UriKind::OTHER;
     }
     if ( k + 2 < input_string.size()
@@ -631,55 +1237,70 @@ UriKind html_link::detectUriKind(std::string_view input_string)
          && input_string[k+2] == '/' )
         return UriKind::GENERIC_URI;
 
-    const std::string scheme = asciitolower(raw_scheme);
     return specialUriSchemeKind(scheme);
 }
 
 namespace
 {
 
-static bool isReservedUrlChar(const char c)
+enum UrlCharClass : uint8_t
 {
-    constexpr std::array<char, 10> reserved = {{';', ',', '?', ':',
-                                               '@', '&', '=', '+', '$' }};
+  URL_CHAR_UNRESERVED, // never escaped
+  URL_CHAR_RESERVED,   // escaped only if reserved characters must be encoded
+  URL_CHAR_OTHER       // always escaped
+};
 
-    return std::any_of(reserved.begin(), reserved.end(),
-                       [&c] (const char &elem) { return elem == c; } );
-}
-
-bool needsEscape(const char c, const bool encodeReserved)
+constexpr std::array<uint8_t, 256> makeUrlCharClassTable()
 {
-  if (isAsciiAlphaNumeric(c))
-    return false;
-
-  if (isReservedUrlChar(c))
-    return encodeReserved;
+  std::array<uint8_t, 256> table{};
+  for (int c = 0; c < 256; ++c) {
+    table[c] = URL_CHAR_OTHER;
+  }
+  for (int c = 'a'; c <= 'z'; ++c) table[c] = URL_CHAR_UNRESERVED;
+  for (int c = 'A'; c <= 'Z'; ++c) table[c] = URL_CHAR_UNRESERVED;
+  for (int c = '0'; c <= '9'; ++c) table[c] = URL_CHAR_UNRESERVED;
+  for (char c : {'-', '_', '.', '!', '~', '*', '\'', '(', ')', '/'}) {
+    table[static_cast<unsigned char>(c)] = URL_CHAR_UNRESERVED;
+  }
+  for (char c : {';', ',', '?', ':', '@', '&', '=', '+', '$'}) {
+    table[static_cast<unsigned char>(c)] = URL_CHAR_RESERVED;
+  }
+  return table;
+}
 
-  constexpr std::array<char, 10> noNeedEscape = {{'-', '_', '.', '!', '~',
-                                                '*', '\'', '(', ')', '/' }};
+constexpr std::array<uint8_t, 256> urlCharClassTable = makeUrlCharClassTable();
 
-  return not std::any_of(noNeedEscape.begin(), noNeedEscape.end(),
-                         [&c] (const char &elem) { return elem == c; } );
-}
+} // unnamed namespace
 
-std::string urlEncode(const std::string& value, bool encodeReserved)
+std::string urlEncode(std::string_view value, bool encodeReserved)
 {
-  std::ostringstream os;
-  os << std::hex << std::uppercase;
-  for (std::string::const_iterator it = value.begin();
-       it != value.end();
-       ++it) {
-    if (!needsEscape(*it, encodeReserved)) {
-      os << *it;
-    } else {
-      os << '%' << std::setw(2) << static_cast<unsigned int>(static_cast<unsigned char>(*it));
+  // Characters of this class or above are escaped
+  const uint8_t escapedClass = encodeReserved ? URL_CHAR_RESERVED : URL_CHAR_OTHER;
+  static const char hexDigits[] = "0123456789ABCDEF";
+
+  std::string encoded;
+  encoded.reserve(value.size());
+  const char* p = value.data();
+  const char* const end = p + value.size();
+  while (p != end) {
+    // copy the run of characters that don't need escaping at once
+    const char* runEnd = p;
+    while (runEnd != end && urlCharClassTable[static_cast<unsigned char>(*runEnd)] < escapedClass) {
+      ++runEnd;
     }
+    encoded.append(p, runEnd);
+    if (runEnd == end) {
+      break;
+    }
+
+    const unsigned char c = *runEnd;
+    const char escape[3] = {'%', hexDigits[c >> 4], hexDigits[c & 0xF]};
+    encoded.append(escape, 3);
+    p = runEnd + 1;
   }
-  return os.str();
+  return encoded;
 }
 
-} // unnamed namespace
-
 std::string httpRedirectHtml(const std::string& redirectUrl)
 {
     const auto encodedurl = urlEncode(redirectUrl, true);
@@ -701,38 +1322,198 @@ bool guess_is_front_article(std::string_view mimetype) {
         && mimetype.find("raw=true") == std::string_view::npos);
 }
 
+namespace
+{
+
+// Returns the length of the run of ASCII characters starting at p
+size_t countAsciiChars(const char* p, const char* end)
+{
+  const char* const start = p;
+#ifdef __SSE2__
+  for ( ; end - p >= 16; p += 16 ) {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    if ( _mm_movemask_epi8(chunk) != 0 )
+      break;
+  }
+#endif
+  for ( ; end - p >= 8; p += 8 ) {
+    uint64_t chunk;
+    memcpy(&chunk, p, sizeof(chunk));
+    if ( chunk & 0x8080808080808080ULL )
+      break;
+  }
+  while ( p != end && static_cast<unsigned char>(*p) < 0x80 )
+    ++p;
+  return p - start;
+}
+
+bool isUtf8ContinuationByte(unsigned char c)
+{
+  return (c & 0xC0) == 0x80;
+}
+
+// Returns how many of the (at most available) bytes at p match the start
+// of a well-formed UTF-8 sequence of a non-ASCII character, and the length
+// of that sequence in sequenceLength (0 if p[0] can't start one). See
+// Table 3-7 "Well-Formed UTF-8 Byte Sequences" of the Unicode Standard.
+size_t matchUtf8Sequence(const unsigned char* p, size_t available, size_t& sequenceLength)
+{
+  const unsigned char c = p[0];
+  // Range of the second byte
+  unsigned char min = 0x80, max = 0xBF;
+  if ( c >= 0xC2 && c <= 0xDF ) {
+    sequenceLength = 2;
+  } else if ( c >= 0xE0 && c <= 0xEF ) {
+    sequenceLength = 3;
+    if ( c == 0xE0 ) min = 0xA0; // overlong
+    if ( c == 0xED ) max = 0x9F; // surrogates
+  } else if ( c >= 0xF0 && c <= 0xF4 ) {
+    sequenceLength = 4;
+    if ( c == 0xF0 ) min = 0x90; // overlong
+    if ( c == 0xF4 ) max = 0x8F; // above U+10FFFF
+  } else {
+    sequenceLength = 0;
+    return 0;
+  }
+
+  size_t n = 1;
+  for ( ; n < sequenceLength && n < available; ++n ) {
+    if ( p[n] < min || p[n] > max )
+      break;
+    min = 0x80;
+    max = 0xBF;
+  }
+  return n;
+}
+
+// Returns the length of the well-formed UTF-8 sequence of a non-ASCII
+// character starting at p, or 0 if the sequence is ill-formed.
+size_t getUtf8SequenceLength(const unsigned char* p, size_t available)
+{
+  size_t sequenceLength;
+  const size_t n = matchUtf8Sequence(p, available, sequenceLength);
+  return n == sequenceLength ? n : 0;
+}
+
+} // unnamed namespace
+
+size_t findInvalidUtf8(std::string_view text, size_t offset)
+{
+  const char* const end = text.data() + text.size();
+  const char* p = text.data() + std::min(offset, text.size());
+  while ( true ) {
+    p += countAsciiChars(p, end);
+    if ( p == end )
+      return text.size();
+
+    const size_t n = getUtf8SequenceLength(reinterpret_cast<const unsigned char*>(p), end - p);
+    if ( n == 0 )
+      return p - text.data();
+    p += n;
+  }
+}
+
+size_t getInvalidUtf8Length(std::string_view text, size_t offset)
+{
+  if ( offset >= text.size() )
+    return 0;
+
+  size_t sequenceLength;
+  const auto p = reinterpret_cast<const unsigned char*>(text.data()) + offset;
+  return std::max<size_t>(1, matchUtf8Sequence(p, text.size() - offset, sequenceLength));
+}
+
+namespace
+{
+
+// Length of an ASCII text in graphemes: every character is a grapheme except
+// that CR LF is a single one.
+size_t getAsciiTextLength(std::string_view text)
+{
+  size_t crlfCount = 0;
+  const char* const end = text.data() + text.size();
+  const char* p = text.data();
+  while ( (p = static_cast<const char*>(memchr(p, '\r', end - p))) != nullptr ) {
+    if ( ++p != end && *p == '\n' )
+      ++crlfCount;
+  }
+  return text.size() - crlfCount;
+}
+
+size_t countCodePoints(std::string_view text)
+{
+  return std::count_if(text.begin(), text.end(),
+                       [](char c) { return !isUtf8ContinuationByte(c); });
+}
+
+// Counts graphemes with an ICU character break iterator working directly on
+// the UTF-8 text (no conversion to UTF-16).
+class GraphemeCounter
+{
+public:
+  GraphemeCounter()
+  {
+    UErrorCode status = U_ZERO_ERROR;
+    breakIterator.reset(
+        icu::BreakIterator::createCharacterInstance(icu::Locale::getRoot(), status));
+    if ( U_FAILURE(status) )
+      breakIterator.reset();
+  }
+
+  ~GraphemeCounter() { utext_close(&utext); }
+
+  GraphemeCounter(const GraphemeCounter&) = delete;
+  GraphemeCounter& operator=(const GraphemeCounter&) = delete;
+
+  size_t count(std::string_view text)
+  {
+    if ( countAsciiChars(text.data(), text.data() + text.size()) == text.size() )
+      return getAsciiTextLength(text);
+
+    if ( !breakIterator )
+      return countCodePoints(text);
+
+    UErrorCode status = U_ZERO_ERROR;
+    utext_openUTF8(&utext, text.data(), text.size(), &status);
+    breakIterator->setText(&utext, status);
+    if ( U_FAILURE(status) )
+      return countCodePoints(text);
+
+    size_t count = 0;
+    while (breakIterator->next() != icu::BreakIterator::DONE) {
+      ++count;
+    }
+    return count;
+  }
+
+private:
+  std::unique_ptr<icu::BreakIterator> breakIterator;
+  UText utext = UTEXT_INITIALIZER;
+};
+
+// Creating a break iterator is expensive (its rules have to be loaded) and
+// a break iterator can't be shared between threads, so every thread keeps
+// its own.
+GraphemeCounter& getThreadGraphemeCounter()
+{
+  thread_local GraphemeCounter graphemeCounter;
+  return graphemeCounter;
+}
+
+} // unnamed namespace
+
 size_t getTextLength(std::string_view utf8EncodedString)
 {
-  // For some unknown reason implicite convertion from std::string to icu::StringPiece
-  // is broken on Windows.
-  // Constructors are definde in stringpiece.h as
-  // ```
-  // StringPiece(const std::string& str)
-  //  : ptr_(str.data()), length_(static_cast<int32_t>(str.size())) { }
-  // StringPiece(const char* offset, int32_t len) : ptr_(offset), length_(len) { }
-  // ```
-  // However using the first constructor ends with a corrupted StringPiece (wrong ptr)
-  // and using second one works. Don't ask me why
-  // This is broken
-  // icu::StringPiece stringPiece(utf8EncodedString);
-  // This is not
-  icu::StringPiece stringPiece(utf8EncodedString.data(),
-                               static_cast<int32_t>(utf8EncodedString.size()));
-  icu::UnicodeString ustr = icu::UnicodeString::fromUTF8(stringPiece);
-
-  UErrorCode status = U_ZERO_ERROR;
-  std::unique_ptr<icu::BreakIterator> bi(
-      icu::BreakIterator::createCharacterInstance(icu::Locale::getRoot(), status));
-
-  if (!U_SUCCESS(status)) {
-    return ustr.length();  // Fallback to codepoint count
-  }
-
-  bi->setText(ustr);
-
-  size_t count = 0;
-  while (bi->next() != icu::BreakIterator::DONE) {
-    ++count;
-  }
-  return count;
+  return getThreadGraphemeCounter().count(utf8EncodedString);
+}
+
+std::vector<size_t> getTextLengths(const std::vector<std::string_view>& utf8EncodedStrings)
+{
+  GraphemeCounter& graphemeCounter = getThreadGraphemeCounter();
+  std::vector<size_t> lengths;
+  lengths.reserve(utf8EncodedStrings.size());
+  for ( const auto& s : utf8EncodedStrings ) {
+    lengths.push_back(graphemeCounter.count(s));
+  }
+  return lengths;
 }
@@ -24,6 +24,8 @@
 #include <map>
 #include <string>
 #include <string_view>
+#include <array>
+#include <cstdint>
 #include <vector>
 #include <stdexcept>
 #include <sstream>
@@ -93,12 +95,15 @@ public:
         , uriKind(detectUriKind(_link))
     {}
 
-    bool isExternalUrl() const
+    bool isExternalUrl() const { return isExternalUrl(uriKind); }
+    bool isInternalUrl() const { return isInternalUrl(uriKind); }
+
+    static bool isExternalUrl(UriKind uriKind)
     {
         return uriKind != UriKind::OTHER && uriKind != UriKind::DATA;
     }
 
-    bool isInternalUrl() const
+    static bool isInternalUrl(UriKind uriKind)
     {
         return uriKind == UriKind::OTHER;
     }
@@ -106,6 +111,32 @@ public:
     static UriKind detectUriKind(std::string_view input_string);
 };
 
+// HtmlLinkScanner finds the links (under 'href' and 'src') of an HTML page
+// one after another without allocating memory. The page must outlive the
+// scanner.
+class HtmlLinkScanner
+{
+public:
+    explicit HtmlLinkScanner(std::string_view page)
+        : p(page.data())
+        , end(page.data() + page.size())
+    {}
+
+    // Finds the next link (returning false if there are no more links).
+    // The HTML character references in link are NOT decoded.
+    bool next(html_link::AttributeKind& attribute, std::string_view& link);
+
+private:
+    const char* p;
+    const char* const end;
+
+    // The difference of the counts of the '<' and '>' characters preceding
+    // the current position. In a valid HTML without comments it should only
+    // take values 0 or 1.
+    int ltgtBalance = 0;
+    bool processingAScriptTag = false;
+};
+
 // Few helper class to help copy a item from a archive to another one.
 class ItemProvider : public zim::writer::ContentProvider
 {
@@ -170,22 +201,40 @@ class CopyItem : public zim::writer::Item         //Article class that will be p
     }
 };
 
-std::string decodeUrl(const std::string& encodedUrl);
+std::string decodeUrl(std::string_view encodedUrl);
+
+// Percent-encodes the characters of value that may not appear in a URL
+// (as well as the reserved characters ;,?:@&=+$ if encodeReserved is true)
+std::string urlEncode(std::string_view value, bool encodeReserved);
 
 // Assuming that basePath and targetPath are relative to the same location
 // returns the relative path of targetPath from basePath
-std::string computeRelativePath(const std::string& basePath,
-                                const std::string& targetPath);
+std::string computeRelativePath(std::string_view basePath,
+                                std::string_view targetPath);
 
-std::string computeAbsolutePath(const std::string& path,
-                                const std::string& relativePath);
+std::string computeAbsolutePath(std::string_view path,
+                                std::string_view relativePath);
 bool fileExists(const std::string& path);
 bool isDirectory(const std::string &path);
 std::string getFileExtension(std::string_view path);
 
+std::string base64_encode(std::string_view data);
 std::string base64_encode(unsigned char const* bytes_to_encode,
                           unsigned int in_len);
 
+// Decodes base64 data following the "forgiving-base64 decode" algorithm of
+// https://infra.spec.whatwg.org/#forgiving-base64 (used for data: URLs):
+// ASCII whitespace is ignored and the trailing '=' padding is optional.
+// Returns false (leaving decoded in an unspecified state) if the data is
+// not valid base64.
+bool base64_decode(std::string_view encoded, std::string& decoded);
+
+// Selects the implementation of base64_encode() and base64_decode(): the
+// vectorized one (used by default if the CPU supports it) or the scalar one.
+// Returns whether the vectorized implementation is used. Meant for tests
+// and benchmarks (not to be called while base64 data is processed).
+bool useVectorizedBase64(bool enabled);
+
 void replaceStringInPlaceOnce(std::string& subject,
                               std::string_view search,
                               std::string_view replace);
@@ -194,14 +243,56 @@ void replaceStringInPlace(std::string& subject,
                           std::string_view replace);
 void stripTitleInvalidChars(std::string& str);
 
+// MultiStringReplacer replaces the occurrences of several patterns in a
+// single pass over a text. The patterns are stored in a trie, so that the
+// cost of a replacement is proportional to the size of the text (times the
+// length of the longest pattern) independently of the number of patterns.
+// Matches are searched from left to right; when several patterns start at
+// the same position the longest one wins. Replacement strings aren't
+// searched for patterns again. Empty patterns are ignored.
+class MultiStringReplacer
+{
+public: // types
+  typedef std::vector<std::pair<std::string, std::string>> Replacements;
+
+public: // functions
+  explicit MultiStringReplacer(const Replacements& replacements);
+
+  // Appends text with the patterns replaced to result
+  void replace(std::string_view text, std::string& result) const;
+
+  std::string replace(std::string_view text) const;
+
+private: // data
+  // Bytes are mapped to classes (bytes not used in any pattern sharing the
+  // class 0) which keeps the transition table small. There may be 257
+  // classes (all the bytes used in patterns).
+  std::array<uint16_t, 256> byteClass;
+  size_t classCount;
+
+  // transitions[node * classCount + byteClass] is the child of node (0 if
+  // none, the root being the node 0)
+  std::vector<uint32_t> transitions;
+
+  // Index in replacementStrings of the pattern ending at each node (or -1)
+  std::vector<int32_t> nodeReplacement;
+  std::vector<std::string> replacementStrings;
+};
+
 //Returns a vector of the links in a particular page. includes links under 'href' and 'src'
 std::vector<html_link> generic_getLinks(const std::string& page);
 
 //Adler32 Hash Function. Used to hash the BLOB data obtained from each article, for redundancy checks.
 //Please note that the adler32 hash function has a high number of collisions, and that the hash match is not taken as final.
-int adler32(const std::string& buf);
+int adler32(std::string_view buf);
 
-std::string decodeHtmlEntities(const std::string& str);
+// Decodes the HTML character references (named ones like "&nbsp;" and
+// numeric ones like "&#x2F;") of str as an HTML5 parser would. Character
+// references in attribute values are decoded slightly differently (see
+// https://html.spec.whatwg.org/multipage/parsing.html#named-character-reference-state)
+// The first version appends the decoded text to result.
+void decodeHtmlEntities(std::string_view str, std::string& result, bool inAttributeValue = false);
+std::string decodeHtmlEntities(std::string_view str, bool inAttributeValue = false);
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -255,15 +346,93 @@ std::string resolveLinkTarget(std::string url, const std::string& zimPath);
 class InternalLinkResolver
 {
 public: // functions
+  InternalLinkResolver() {}
   explicit InternalLinkResolver(const std::string& zimPath);
 
+  // Makes the links resolved relative to zimPath (reusing the memory of
+  // the previous path)
+  void setZimPath(const std::string& zimPath);
+
   std::string resolveLinkTarget(std::string url) const;
 
+  // Same as above, but the result is stored in resolvedPath. No memory is
+  // allocated if resolvedPath already has enough capacity, so resolving many
+  // links with the same buffer doesn't allocate in the steady state.
+  void resolveLinkTarget(std::string_view url, std::string& resolvedPath) const;
+
 private: // data
   std::string zimEntryPath;
   std::string basePath;
 };
 
+// LinkTargetBatch collects the resolved targets of the internal links of a
+// page. Each distinct target of the page is stored once and identified by a
+// 32-bit id, the links only refer to that id. The ids are scoped to the page:
+// they are reassigned when the batch is cleared for the next page, so the
+// memory used is bounded by the biggest page. All buffers are reused from
+// page to page, so that resolving and grouping the links doesn't allocate
+// memory in the steady state.
+class LinkTargetBatch
+{
+public: // types
+  typedef uint32_t TargetId;
+
+  struct Link
+  {
+    TargetId target; // id of the resolved target
+    size_t id;       // caller-defined identifier of the link
+  };
+
+public: // functions
+  void clear();
+
+  // Resolves url with the given resolver and adds it to the batch.
+  // Throws the same exceptions as InternalLinkResolver::resolveLinkTarget()
+  // (in which case the batch is left unchanged).
+  void add(const InternalLinkResolver& resolver, std::string_view url, size_t id);
+
+  // Renumbers the targets in lexicographic order and sorts the links by
+  // target, so that the links with the same target are adjacent (and
+  // ordered by id). No link can be added after that until clear().
+  void sortByTarget();
+
+  const std::vector<Link>& links() const { return linkVector; }
+
+  // Number of distinct targets (their ids are 0 to targetCount() - 1)
+  size_t targetCount() const { return targetVector.size(); }
+
+  std::string_view target(TargetId id) const
+  {
+    const Target& t = targetVector[id];
+    return std::string_view(targetData.data() + t.offset, t.size);
+  }
+
+  std::string_view target(const Link& link) const { return target(link.target); }
+
+private: // types
+  struct Target
+  {
+    size_t offset; // position of the target in targetData
+    size_t size;
+    size_t slot;   // position of its id in the hash table
+  };
+
+private: // functions
+  TargetId intern(std::string_view s);
+  void growHashTable();
+
+private: // data
+  std::string targetData;
+  std::vector<Target> targetVector;
+  // Open addressing hash table of the target ids (linear probing)
+  std::vector<TargetId> hashTable;
+  // Buffers of sortByTarget()
+  std::vector<TargetId> order;
+  std::vector<Target> sortedTargets;
+  std::string resolvedPath;
+  std::vector<Link> linkVector;
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 // End of stuff related to internal link resolution
 ////////////////////////////////////////////////////////////////////////////////
@@ -276,4 +445,17 @@ std::string asciitolower(std::string s);
 // Return the count of graphemes in the provided text string
 size_t getTextLength(std::string_view utf8EncodedString);
 
+// Return the count of graphemes of each of the provided text strings
+std::vector<size_t> getTextLengths(const std::vector<std::string_view>& utf8EncodedStrings);
+
+// Returns the offset of the first invalid UTF-8 sequence in text at or after
+// the given offset (or text.size() if the rest of the text is valid UTF-8).
+// Overlong encodings, surrogates and code points above U+10FFFF are invalid.
+size_t findInvalidUtf8(std::string_view text, size_t offset = 0);
+
+// Returns the length of the invalid UTF-8 sequence at offset (as found by
+// findInvalidUtf8()): its maximal subpart, i.e. the bytes a decoder replaces
+// with a single U+FFFD.
+size_t getInvalidUtf8Length(std::string_view text, size_t offset);
+
 #endif  // OPENZIM_TOOLS_H
@@ -2,9 +2,13 @@
 #include "checks.h"
 #include "../tools.h"
 #include "../concurrent_cache.h"
+#include "../arena.h"
 #include "../metadata.h"
 
 #include <cassert>
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
 #include <map>
 #include <unordered_map>
 #include <list>
@@ -14,6 +18,8 @@
 #include <mutex>
 #include <thread>
 #include <queue>
+#include <set>
+#include <fstream>
 #include <zim/archive.h>
 #include <zim/item.h>
 
@@ -37,6 +43,9 @@ std::unordered_map<TestType, std::pair<LogTag, std::string>> errormapping = {
     { TestType::URL_EXTERNAL,  {LogTag::ERROR, "External URL"}},
     { TestType::URL_EMPTY,     {LogTag::WARNING, "Empty link"}},
     { TestType::REDIRECT,      {LogTag::ERROR, "Redirect Loop"}},
+    { TestType::REDIRECT_CHAIN, {LogTag::WARNING, "Redirect Chain"}},
+    { TestType::UTF8,          {LogTag::WARNING, "Invalid UTF-8"}},
+    { TestType::CLUSTERS,      {LogTag::WARNING, "Cluster Layout"}},
 };
 
 struct MsgInfo
@@ -57,7 +66,14 @@ std::unordered_map<MsgId, MsgInfo> msgTable = {
   { MsgId::REDUNDANT_ITEMS,  { TestType::REDUNDANT, "{{&path1}} and {{&path2}}" } },
   { MsgId::METADATA,         { TestType::METADATA, "{{&error}}" } },
   { MsgId::REDIRECT_LOOP,    { TestType::REDIRECT, "Redirect loop exists from entry {{&entry_path}}\n"  } },
-  { MsgId::MISSING_FAVICON,  { TestType::FAVICON, "Favicon is missing" } }
+  { MsgId::MISSING_FAVICON,  { TestType::FAVICON, "Favicon is missing" } },
+  { MsgId::INVALID_UTF8_TITLE, { TestType::UTF8, "Title of entry {{&path}} has invalid byte sequences at offset(s) {{&offsets}}" } },
+  { MsgId::INVALID_UTF8_CONTENT, { TestType::UTF8, "Entry {{&path}} has invalid byte sequences at offset(s) {{&offsets}}" } },
+  { MsgId::REDIRECT_CHAIN,   { TestType::REDIRECT_CHAIN, "Entry {{&entry_path}} redirects to {{&target_path}} through a chain of {{&depth}} redirections" } },
+  { MsgId::OVERSIZED_CLUSTER, { TestType::CLUSTERS, "Cluster #{{&cluster}} ({{&compression}}) holds {{&data_size}} bytes of data in {{&blob_count}} blobs" } },
+  { MsgId::INEFFICIENT_COMPRESSION, { TestType::CLUSTERS, "Compression of cluster #{{&cluster}} ({{&compression}}) is inefficient: {{&stored_size}} bytes stored for {{&data_size}} bytes of data" } },
+  { MsgId::PRECOMPRESSED_DATA, { TestType::CLUSTERS, "Cluster #{{&cluster}} ({{&compression}}) contains already compressed data ({{&mimetypes}})" } },
+  { MsgId::UNKNOWN_CLUSTER_SIZE, { TestType::CLUSTERS, "The stored size of {{&count}} cluster(s) is unknown ({{&reason}})" } }
 };
 
 using kainjow::mustache::mustache;
@@ -83,6 +99,9 @@ const char* toStr(TestType tt) {
     case TestType::URL_EXTERNAL: return "url_external";
     case TestType::URL_EMPTY:    return "url_empty";
     case TestType::REDIRECT:     return "redirect";
+    case TestType::REDIRECT_CHAIN: return "redirect_chain";
+    case TestType::UTF8:         return "utf8";
+    case TestType::CLUSTERS:     return "clusters";
     default:  throw std::logic_error("Invalid TestType");
   };
 }
@@ -93,6 +112,27 @@ SortedMsgParams sortedMsgParams(const MsgParams& msgParams)
   return SortedMsgParams(msgParams.begin(), msgParams.end());
 }
 
+// Number of invalid UTF-8 sequences reported per text
+const size_t MAX_REPORTED_UTF8_ERRORS = 5;
+
+// Returns the comma separated offsets of the first invalid UTF-8 sequences
+// in text (or an empty string if text is valid UTF-8)
+std::string getInvalidUtf8Offsets(std::string_view text)
+{
+    std::string offsets;
+    size_t offset = findInvalidUtf8(text);
+    for ( size_t n = 0; n < MAX_REPORTED_UTF8_ERRORS && offset < text.size(); ++n ) {
+        offsets += (offsets.empty() ? "" : ", ") + std::to_string(offset);
+        offset = findInvalidUtf8(text, offset + getInvalidUtf8Length(text, offset));
+    }
+    return offsets;
+}
+
+bool isTextMimetype(const std::string& mimetype)
+{
+    return mimetype.compare(0, 5, "text/") == 0;
+}
+
 bool areAliases(const zim::Item& i1, const zim::Item& i2)
 {
     return i1.getClusterIndex() == i2.getClusterIndex() && i1.getBlobIndex() == i2.getBlobIndex();
@@ -146,6 +186,88 @@ JSON::OutputStream& operator<<(JSON::OutputStream& out, EnabledTests checks)
   return out;
 }
 
+namespace
+{
+
+JSON::OutputStream& operator<<(JSON::OutputStream& out, const EntryCost& c)
+{
+  out << JSON::startObject;
+  out << JSON::property("path", c.path);
+  out << JSON::property("cluster", c.cluster);
+  out << JSON::property("size", c.size);
+  out << JSON::property("link_count", c.linkCount);
+  out << JSON::property("data_time_ms", c.dataTime);
+  out << JSON::property("check_time_ms", c.checkTime);
+  out << JSON::endObject;
+  return out;
+}
+
+JSON::OutputStream& operator<<(JSON::OutputStream& out, const ClusterCost& c)
+{
+  out << JSON::startObject;
+  out << JSON::property("cluster", c.cluster);
+  out << JSON::property("item_count", c.itemCount);
+  out << JSON::property("size", c.size);
+  out << JSON::property("link_count", c.linkCount);
+  out << JSON::property("data_time_ms", c.dataTime);
+  out << JSON::property("check_time_ms", c.checkTime);
+  out << JSON::endObject;
+  return out;
+}
+
+template<class T>
+void outputArray(JSON::OutputStream& out, const std::string& key, const std::vector<T>& v)
+{
+  out << JSON::property(key, JSON::startArray);
+  for ( const auto& x : v ) {
+    out << x;
+  }
+  out << JSON::endArray;
+}
+
+} // unnamed namespace
+
+JSON::OutputStream& operator<<(JSON::OutputStream& out, const ArticleCostReport& report)
+{
+  out << JSON::startObject;
+  outputArray(out, "entries", report.slowestEntries);
+  outputArray(out, "clusters", report.slowestClusters);
+  out << JSON::endObject;
+  return out;
+}
+
+JSON::OutputStream& operator<<(JSON::OutputStream& out, const RedirectDepthReport& report)
+{
+  out << JSON::startArray;
+  for ( size_t depth = 0; depth < report.depthHistogram.size(); ++depth ) {
+    if ( report.depthHistogram[depth] != 0 ) {
+      out << JSON::startObject;
+      out << JSON::property("depth", depth);
+      out << JSON::property("count", report.depthHistogram[depth]);
+      out << JSON::endObject;
+    }
+  }
+  out << JSON::endArray;
+  return out;
+}
+
+JSON::OutputStream& operator<<(JSON::OutputStream& out, const ClusterLayoutReport& report)
+{
+  out << JSON::startArray;
+  for ( const auto& c : report.compressionStats ) {
+    out << JSON::startObject;
+    out << JSON::property("compression", c.compression);
+    out << JSON::property("cluster_count", c.clusterCount);
+    out << JSON::property("blob_count", c.blobCount);
+    out << JSON::property("stored_size", c.storedSize);
+    out << JSON::property("data_size", c.dataSize);
+    out << JSON::property("decompression_time_ms", c.decompressionTime);
+    out << JSON::endObject;
+  }
+  out << JSON::endArray;
+  return out;
+}
+
 ErrorLogger::ErrorLogger(bool _jsonOutputMode)
   : jsonOutputStream(_jsonOutputMode ? &std::cout : nullptr)
 {
@@ -257,7 +379,58 @@ bool test_integrity(const std::string& filename, ErrorLogger& reporter) {
 }
 
 
-void test_metadata(const zim::Archive& archive, ErrorLogger& reporter) {
+namespace
+{
+
+// Namespaces of the content in old namespace scheme archives
+bool isOldContentNamespace(const std::string& path)
+{
+    return path.size() >= 2 && path[1] == '/'
+        && (path[0] == '-' || path[0] == 'A' || path[0] == 'I' || path[0] == 'J');
+}
+
+} // unnamed namespace
+
+// Only the directory entries are read (no cluster is decompressed), in
+// parallel by thread_count threads.
+std::map<std::string, size_t> countItemsByMimeType(const zim::Archive& archive, bool allNamespaces,
+                                                   int thread_count)
+{
+    // getEntryCount() only counts the entries of the C namespace in new
+    // namespace scheme archives but all of them in old ones
+    const bool checkNamespace = !allNamespaces && !archive.hasNewNamespaceScheme();
+    const zim::entry_index_type entryCount = archive.getEntryCount();
+    const size_t threadCount = std::max(1, thread_count);
+    std::vector<zim::Metadata::MimeTypeCounter> counters(threadCount);
+    auto worker = [&](size_t threadIndex) {
+        auto& counter = counters[threadIndex];
+        const zim::entry_index_type begin = entryCount * threadIndex / threadCount;
+        const zim::entry_index_type end = entryCount * (threadIndex + 1) / threadCount;
+        for ( auto i = begin; i < end; ++i ) {
+            const auto entry = archive.getEntryByPath(i);
+            if ( entry.isRedirect() )
+                continue;
+            if ( checkNamespace && !isOldContentNamespace(entry.getPath()) )
+                continue;
+            ++counter[entry.getItem().getMimetype()];
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for ( size_t i = 1; i < threadCount; ++i )
+        threads.emplace_back(worker, i);
+    worker(0);
+    for ( auto& t : threads )
+        t.join();
+
+    for ( size_t i = 1; i < threadCount; ++i ) {
+        for ( const auto& kv : counters[i] )
+            counters[0][kv.first] += kv.second;
+    }
+    return counters[0];
+}
+
+void test_metadata(const zim::Archive& archive, ErrorLogger& reporter, int thread_count) {
     reporter.infoMsg("[INFO] Checking metadata...");
     zim::Metadata metadata;
     for ( const auto& key : archive.getMetadataKeys() ) {
@@ -267,6 +440,16 @@ void test_metadata(const zim::Archive& archive, ErrorLogger& reporter) {
     for (const auto &error : metadata.check()) {
         reporter.addMsg(MsgId::METADATA, {{"error", error}});
     }
+    if (metadata.has("Counter")) {
+        auto errors = metadata.checkCounter(countItemsByMimeType(archive, false, thread_count));
+        if ( !errors.empty() && !archive.hasNewNamespaceScheme()
+             && metadata.checkCounter(countItemsByMimeType(archive, true, thread_count)).empty() ) {
+            errors.clear();
+        }
+        for (const auto &error : errors) {
+            reporter.addMsg(MsgId::METADATA, {{"error", error}});
+        }
+    }
 }
 
 void test_favicon(const zim::Archive& archive, ErrorLogger& reporter) {
@@ -292,10 +475,149 @@ void test_mainpage(const zim::Archive& archive, ErrorLogger& reporter) {
 namespace
 {
 
+typedef std::chrono::steady_clock Clock;
+
+double millisecondsSince(Clock::time_point t)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - t).count();
+}
+
+// TopN keeps the n most expensive of the elements added to it. The kept
+// elements are organized in a min-heap so that the cheapest one can be
+// evicted in O(log n) time.
+template<class T>
+class TopN
+{
+public: // functions
+    explicit TopN(size_t n) : maxSize(n) {}
+
+    void add(T x)
+    {
+        if ( heap.size() < maxSize ) {
+            heap.push_back(std::move(x));
+            std::push_heap(heap.begin(), heap.end(), costlier);
+        } else if ( maxSize != 0 && costlier(x, heap.front()) ) {
+            std::pop_heap(heap.begin(), heap.end(), costlier);
+            heap.back() = std::move(x);
+            std::push_heap(heap.begin(), heap.end(), costlier);
+        }
+    }
+
+    void addAll(const TopN& other)
+    {
+        for ( const auto& x : other.heap )
+            add(x);
+    }
+
+    // Returns the kept elements sorted by decreasing cost
+    std::vector<T> sorted() const
+    {
+        std::vector<T> r(heap);
+        std::sort_heap(r.begin(), r.end(), costlier);
+        return r;
+    }
+
+private: // functions
+    static bool costlier(const T& a, const T& b)
+    {
+        return a.checkTime > b.checkTime;
+    }
+
+private: // data
+    const size_t maxSize;
+    std::vector<T> heap;
+};
+
+// Per-thread accounting of the cost of checking the articles.
+//
+// Relies on the fact that all items of a cluster are checked by the same
+// thread one after another (see TaskDispatcher).
+class CostTracker
+{
+public: // functions
+    explicit CostTracker(size_t n)
+        : slowestEntries(n)
+        , slowestClusters(n)
+    {}
+
+    void add(const EntryCost& c)
+    {
+        if ( currentCluster.itemCount != 0 && currentCluster.cluster != c.cluster ) {
+            flushCluster();
+        }
+
+        currentCluster.cluster = c.cluster;
+        ++currentCluster.itemCount;
+        currentCluster.size += c.size;
+        currentCluster.linkCount += c.linkCount;
+        currentCluster.dataTime += c.dataTime;
+        currentCluster.checkTime += c.checkTime;
+        slowestEntries.add(c);
+    }
+
+    void flushCluster()
+    {
+        if ( currentCluster.itemCount != 0 ) {
+            slowestClusters.add(currentCluster);
+            currentCluster = ClusterCost();
+        }
+    }
+
+    void addAll(CostTracker& other)
+    {
+        other.flushCluster();
+        slowestEntries.addAll(other.slowestEntries);
+        slowestClusters.addAll(other.slowestClusters);
+    }
+
+    ArticleCostReport getReport()
+    {
+        flushCluster();
+        return ArticleCostReport{slowestEntries.sorted(), slowestClusters.sorted()};
+    }
+
+private: // data
+    TopN<EntryCost> slowestEntries;
+    TopN<ClusterCost> slowestClusters;
+    ClusterCost currentCluster;
+};
+
+// Data owned by a thread checking the articles (see TaskStream) and reused
+// from article to article
+struct WorkerData
+{
+    explicit WorkerData(size_t slowestCount)
+        : costTracker(slowestCount)
+        , trackCosts(slowestCount != 0)
+    {}
+
+    CostTracker costTracker;
+    const bool trackCosts;
+    InternalLinkResolver linkResolver;
+    LinkTargetBatch linkTargets;
+    std::string linkKey;  // key of the link status cache
+
+    // Memory for the temporaries of the item being checked (released after
+    // each item)
+    Arena arena;
+    std::string decodedLink;
+    size_t previousLinkCount = 0; // to reserve the links of the next item
+};
+
 class ArticleChecker
 {
 public: // types
-    typedef std::vector<html_link> LinkCollection;
+    // A link of the item being checked. The link either points into the
+    // data of the item or (if it contained HTML character references) into
+    // the arena of the worker.
+    struct ItemLink
+    {
+        html_link::AttributeKind attribute;
+        std::string_view link;
+        UriKind uriKind;
+    };
+
+    typedef std::vector<ItemLink, ArenaAllocator<ItemLink>> LinkCollection;
 
 public: // functions
     ArticleChecker(const zim::Archive& _archive, ErrorLogger& _reporter, ProgressBar& _progress,
@@ -310,24 +632,21 @@ public: // functions
     }
 
 
-    void check(zim::Entry entry);
+    void check(zim::Entry entry, WorkerData& workerData);
     void detect_redundant_articles();
 
 private: // types
-    typedef std::vector<std::string> StringCollection;
-
-    // collection of links grouped into sets of equivalent normalized links
-    typedef std::map<std::string, StringCollection> GroupedLinkCollection;
-
 private: // functions
-    void check_item(const zim::Item& item);
-    void check_internal_links(zim::Item item, const LinkCollection& links);
-    void check_internal_links(zim::Item item, const GroupedLinkCollection& groupedLinks);
-    void check_external_links(zim::Item item, const LinkCollection& links);
+    void check_item(const zim::Item& item, const std::string& path, EntryCost* cost, WorkerData& workerData);
+    void get_links(std::string_view html, LinkCollection& links, WorkerData& workerData);
+    void check_internal_links(const std::string& path, const LinkCollection& links, WorkerData& workerData);
+    void check_internal_links(const std::string& path, const LinkCollection& links,
+                              const LinkTargetBatch& linkTargets, std::string& linkKey);
+    void check_external_links(const std::string& path, const LinkCollection& links);
 
     bool is_valid_internal_link(const std::string& link)
     {
-      return linkStatusCache.getOrPut(link, [=](){
+      return linkStatusCache.getOrPut(link, [&](){
                 return archive.hasEntryByPath(link);
       });
     }
@@ -345,25 +664,46 @@ private: // data
     zim::ConcurrentCache<std::string, bool> linkStatusCache;
 };
 
-void ArticleChecker::check(zim::Entry entry)
+void ArticleChecker::check(zim::Entry entry, WorkerData& workerData)
 {
     progress.report();
+    workerData.arena.reset();
 
     const auto path = entry.getPath();
     const char ns = archive.hasNewNamespaceScheme() ? 'C' : path[0];
 
+    if (options.enabledTests.isEnabled(TestType::UTF8)) {
+        const auto offsets = getInvalidUtf8Offsets(entry.getTitle());
+        if (!offsets.empty()) {
+            reporter.addMsg(MsgId::INVALID_UTF8_TITLE, {{"path", path}, {"offsets", offsets}});
+        }
+    }
+
     if (entry.isRedirect() || ns == 'M') {
         return;
     }
 
-    check_item(entry.getItem());
+    if ( !workerData.trackCosts ) {
+        check_item(entry.getItem(), path, nullptr, workerData);
+        return;
+    }
+
+    const auto startTime = Clock::now();
+    const auto item = entry.getItem();
+    EntryCost cost;
+    check_item(item, path, &cost, workerData);
+    cost.checkTime = millisecondsSince(startTime);
+    cost.path = path;
+    cost.cluster = item.getClusterIndex();
+    cost.size = item.getSize();
+    workerData.costTracker.add(cost);
 }
 
-void ArticleChecker::check_item(const zim::Item& item)
+void ArticleChecker::check_item(const zim::Item& item, const std::string& path, EntryCost* cost,
+                                WorkerData& workerData)
 {
     if (item.getSize() == 0) {
         if (options.enabledTests.isEnabled(TestType::EMPTY)) {
-            const auto path = item.getPath();
             const char ns = archive.hasNewNamespaceScheme() ? 'C' : path[0];
             if (ns == 'C' || ns=='A' || ns == 'I') {
                 reporter.addMsg(MsgId::EMPTY_ENTRY, {{"path", path}});
@@ -372,63 +712,93 @@ void ArticleChecker::check_item(const zim::Item& item)
         return;
     }
 
-    std::string data;
-    if (options.enabledTests.isEnabled(TestType::REDUNDANT) || item.getMimetype() == "text/html")
-        data = item.getData();
+    const auto mimetype = item.getMimetype();
+    const bool checkUtf8 = options.enabledTests.isEnabled(TestType::UTF8) && isTextMimetype(mimetype);
+    zim::Blob blob;
+    if (options.enabledTests.isEnabled(TestType::REDUNDANT) || mimetype == "text/html" || checkUtf8) {
+        const auto startTime = Clock::now();
+        blob = item.getData();
+        if (cost)
+            cost->dataTime = millisecondsSince(startTime);
+    }
+    const std::string_view data(blob.data(), blob.size());
 
     if(options.enabledTests.isEnabled(TestType::REDUNDANT))
         hash_main[adler32(data)].push_back( item.getIndex() );
 
-    if (item.getMimetype() != "text/html")
+    if (checkUtf8) {
+        const auto offsets = getInvalidUtf8Offsets(data);
+        if (!offsets.empty()) {
+            reporter.addMsg(MsgId::INVALID_UTF8_CONTENT, {{"path", path}, {"offsets", offsets}});
+        }
+    }
+
+    if (mimetype != "text/html")
         return;
 
-    ArticleChecker::LinkCollection links;
+    ArticleChecker::LinkCollection links{ArenaAllocator<ItemLink>(workerData.arena)};
     if (options.enabledTests.isEnabled(TestType::URL_INTERNAL) ||
         options.enabledTests.isEnabled(TestType::URL_EXTERNAL)) {
-        links = generic_getLinks(data);
+        // Growing the vector would leave its previous buffers in the arena
+        links.reserve(workerData.previousLinkCount);
+        get_links(data, links, workerData);
+        workerData.previousLinkCount = links.size();
+        if (cost)
+            cost->linkCount = links.size();
     }
 
     if(options.enabledTests.isEnabled(TestType::URL_INTERNAL))
     {
-        check_internal_links(item, links);
+        check_internal_links(path, links, workerData);
     }
 
     if (options.enabledTests.isEnabled(TestType::URL_EXTERNAL))
     {
-        check_external_links(item, links);
+        check_external_links(path, links);
+    }
+}
+
+void ArticleChecker::get_links(std::string_view html, LinkCollection& links, WorkerData& workerData)
+{
+    HtmlLinkScanner scanner(html);
+    html_link::AttributeKind attribute;
+    std::string_view link;
+    while (scanner.next(attribute, link)) {
+        if (link.find('&') != std::string_view::npos) {
+            workerData.decodedLink.clear();
+            decodeHtmlEntities(link, workerData.decodedLink, true);
+            link = workerData.arena.copy(workerData.decodedLink);
+        }
+        links.push_back({attribute, link, html_link::detectUriKind(link)});
     }
 }
 
-void ArticleChecker::check_internal_links(zim::Item item, const LinkCollection& links)
+void ArticleChecker::check_internal_links(const std::string& path, const LinkCollection& links, WorkerData& workerData)
 {
-    const auto path = item.getPath();
-    InternalLinkResolver linkResolver(path);
+    InternalLinkResolver& linkResolver = workerData.linkResolver;
+    linkResolver.setZimPath(path);
+    LinkTargetBatch& linkTargets = workerData.linkTargets;
 
-    ArticleChecker::GroupedLinkCollection groupedLinks;
+    linkTargets.clear();
     int nremptylinks = 0;
-    for (const auto &l : links)
+    for (size_t i = 0; i < links.size(); ++i)
     {
+        const auto& l = links[i];
         if (l.link.empty())
         {
             nremptylinks++;
             continue;
         }
         if (l.link.front() == '#' || l.link.front() == '?') continue;
-        if (l.isInternalUrl() == false) continue;
+        if (html_link::isInternalUrl(l.uriKind) == false) continue;
 
-
-        std::string resolved;
         try {
-            resolved = linkResolver.resolveLinkTarget(l.link);
+            linkTargets.add(linkResolver, l.link, i);
         } catch ( const AbsolutePathURL& ) {
-            reporter.addMsg(MsgId::ABSPATH_LINK, {{"link", l.link}, {"path", path}});
-            continue;
+            reporter.addMsg(MsgId::ABSPATH_LINK, {{"link", std::string(l.link)}, {"path", path}});
         } catch ( const OutOfBoundsURL& ) {
-            reporter.addMsg(MsgId::OUTOFBOUNDS_LINK, {{"link", l.link}, {"path", path}});
-            continue;
+            reporter.addMsg(MsgId::OUTOFBOUNDS_LINK, {{"link", std::string(l.link)}, {"path", path}});
         }
-
-        groupedLinks[resolved].push_back(l.link);
     }
 
     if (nremptylinks)
@@ -436,34 +806,42 @@ void ArticleChecker::check_internal_links(zim::Item item, const LinkCollection&
         reporter.addMsg(MsgId::EMPTY_LINKS, {{"count", toStr(nremptylinks)}, {"path", path}});
     }
 
-    check_internal_links(item, groupedLinks);
+    // Grouping the links by sorting them (rather than with a hash table)
+    // keeps the dangling links reported in a deterministic order
+    linkTargets.sortByTarget();
+    check_internal_links(path, links, linkTargets, workerData.linkKey);
 }
 
-void ArticleChecker::check_internal_links(zim::Item item, const GroupedLinkCollection& groupedLinks)
+void ArticleChecker::check_internal_links(const std::string& path, const LinkCollection& links,
+                                          const LinkTargetBatch& linkTargets, std::string& linkKey)
 {
-    const auto path = item.getPath();
-    for(const auto &p: groupedLinks)
+    const auto& targetLinks = linkTargets.links();
+    for (auto groupStart = targetLinks.begin(); groupStart != targetLinks.end(); )
     {
-        const std::string link = p.first;
-        if (!is_valid_internal_link(link)) {
-            kainjow::mustache::list links;
-            for (const auto &olink : p.second)
-                links.push_back({"value", olink});
-            reporter.addMsg(MsgId::DANGLING_LINKS, {{"path", path}, {"normalized_link", link}, {"links", links}});
+        const auto targetId = groupStart->target;
+        const auto groupEnd = std::find_if(groupStart, targetLinks.end(),
+            [&](const LinkTargetBatch::Link& l) { return l.target != targetId; });
+
+        linkKey.assign(linkTargets.target(targetId));
+        if (!is_valid_internal_link(linkKey)) {
+            kainjow::mustache::list olinks;
+            for (auto it = groupStart; it != groupEnd; ++it)
+                olinks.push_back({"value", std::string(links[it->id].link)});
+            reporter.addMsg(MsgId::DANGLING_LINKS, {{"path", path}, {"normalized_link", linkKey}, {"links", olinks}});
             if (options.quick)
                 break;
         }
+        groupStart = groupEnd;
     }
 }
 
-void ArticleChecker::check_external_links(zim::Item item, const LinkCollection& links)
+void ArticleChecker::check_external_links(const std::string& path, const LinkCollection& links)
 {
-    const auto path = item.getPath();
     for (const auto &l: links)
     {
-        if (l.attribute == html_link::SRC && l.isExternalUrl())
+        if (l.attribute == html_link::SRC && html_link::isExternalUrl(l.uriKind))
         {
-            reporter.addMsg(MsgId::EXTERNAL_LINK, {{"link", l.link}, {"path", path}});
+            reporter.addMsg(MsgId::EXTERNAL_LINK, {{"link", std::string(l.link)}, {"path", path}});
             if (options.quick)
                 break;
         }
@@ -516,8 +894,9 @@ public: // constants
     const static size_t MAX_SIZE = 1000;
 
 public: // functions
-    explicit TaskStream(ArticleChecker* ac)
+    TaskStream(ArticleChecker* ac, size_t slowestCount)
         : articleChecker(*ac)
+        , workerData(slowestCount)
         , expectingMoreTasks(true)
     {
         thread = std::thread([this]() { this->processTasks(); });
@@ -557,6 +936,9 @@ public: // functions
         unblockOut();
     }
 
+    // Must be called only after finish()
+    CostTracker& getCostTracker() { return workerData.costTracker; }
+
 private: // types
     typedef std::shared_ptr<zim::Entry> Task;
 
@@ -568,7 +950,7 @@ private: // functions
             const auto t = getNextTask();
             if ( !t )
                 break;
-            articleChecker.check(*t);
+            articleChecker.check(*t, workerData);
         }
     }
 
@@ -620,6 +1002,7 @@ private: // functions
 
 private: // data
     ArticleChecker& articleChecker;
+    WorkerData workerData;
     std::queue<zim::Entry> taskQueue;
     std::mutex mutex;
     std::thread thread;
@@ -647,11 +1030,11 @@ zim::cluster_index_type getClusterIndexOfZimEntry(zim::Entry e)
 class TaskDispatcher
 {
 public: // functions
-    explicit TaskDispatcher(ArticleChecker* ac, unsigned n)
+    TaskDispatcher(ArticleChecker* ac, unsigned n, size_t slowestCount)
         : currentCluster(-1)
     {
         while ( n-- )
-            taskStreams.emplace_back(ac);
+            taskStreams.emplace_back(ac, slowestCount);
     }
 
     void addTask(zim::Entry entry)
@@ -668,9 +1051,14 @@ public: // functions
     }
 
     // Wait for all tasks to complete and terminate the worker threads.
+    // The costs tracked by the worker threads are merged into costTracker.
     // The TaskDispatcher object becomes unusable after call to finish().
-    void finish()
+    void finish(CostTracker& costTracker)
     {
+        for ( auto& ts : taskStreams ) {
+            ts.finish();
+            costTracker.addAll(ts.getCostTracker());
+        }
         taskStreams.clear();
     }
 
@@ -681,21 +1069,60 @@ private: // data
 
 } // unnamed namespace
 
-void test_articles(const zim::Archive& archive, ErrorLogger& reporter, ProgressBar& progress,
+namespace
+{
+
+void reportCosts(const ArticleCostReport& report, ErrorLogger& reporter)
+{
+    reporter.infoMsg("[INFO] Slowest entries:");
+    for (const auto& c : report.slowestEntries) {
+        std::ostringstream ss;
+        ss << std::fixed << std::setprecision(3)
+           << "  " << c.path << " : " << c.checkTime << " ms"
+           << " (data: " << c.dataTime << " ms, "
+           << c.size << " bytes, " << c.linkCount << " links, "
+           << "cluster #" << c.cluster << ")";
+        reporter.infoMsg(ss.str());
+    }
+
+    reporter.infoMsg("[INFO] Slowest clusters:");
+    for (const auto& c : report.slowestClusters) {
+        std::ostringstream ss;
+        ss << std::fixed << std::setprecision(3)
+           << "  cluster #" << c.cluster << " : " << c.checkTime << " ms"
+           << " (data: " << c.dataTime << " ms, "
+           << c.itemCount << " items, " << c.size << " bytes, "
+           << c.linkCount << " links)";
+        reporter.infoMsg(ss.str());
+    }
+}
+
+} // unnamed namespace
+
+ArticleCostReport test_articles(const zim::Archive& archive, ErrorLogger& reporter, ProgressBar& progress,
                    const ZimCheckOptions& options, int thread_count) {
     ArticleChecker articleChecker(archive, reporter, progress, options);
     reporter.infoMsg("[INFO] Verifying Articles' content...");
 
-    TaskDispatcher td(&articleChecker, thread_count);
+    CostTracker costTracker(options.slowestCount);
+    TaskDispatcher td(&articleChecker, thread_count, options.slowestCount);
     for (auto& entry:archive.iterEfficient()) {
         td.addTask(entry);
     }
-    td.finish();
+    td.finish(costTracker);
+
+    const auto costReport = costTracker.getReport();
+    if (options.slowestCount != 0)
+    {
+        reportCosts(costReport, reporter);
+    }
 
     if (options.enabledTests.isEnabled(TestType::REDUNDANT))
     {
         articleChecker.detect_redundant_articles();
     }
+
+    return costReport;
 }
 
 namespace
@@ -711,23 +1138,31 @@ private: // types
         NONLOOP
     };
 
+    static const uint32_t UNKNOWN_DEPTH = uint32_t(-1);
+
 public: // functions
     explicit RedirectionTable(size_t entryCount)
     {
         loopStatus.reserve(entryCount);
         redirTable.reserve(entryCount);
+        chainDepth.reserve(entryCount);
+        finalTarget.reserve(entryCount);
     }
 
     void addRedirectionEntry(zim::entry_index_type targetEntryIndex)
     {
         redirTable.push_back(targetEntryIndex);
         loopStatus.push_back(LoopStatus::UNKNOWN);
+        chainDepth.push_back(UNKNOWN_DEPTH);
+        finalTarget.push_back(targetEntryIndex);
     }
 
     void addItem()
     {
+        finalTarget.push_back(redirTable.size());
         redirTable.push_back(redirTable.size());
         loopStatus.push_back(LoopStatus::NONLOOP);
+        chainDepth.push_back(0);
     }
 
     size_t size() const { return redirTable.size(); }
@@ -742,6 +1177,23 @@ public: // functions
         return loopStatus[i] == LOOP;
     }
 
+    // Number of redirections to follow from entry i in order to reach an
+    // item (0 if i is an item).
+    // Must not be called for entries in a redirection loop.
+    uint32_t getChainDepth(zim::entry_index_type i)
+    {
+        resolveChain(i);
+        return chainDepth[i];
+    }
+
+    // The item reached by following the redirections from entry i.
+    // Must not be called for entries in a redirection loop.
+    zim::entry_index_type getFinalTarget(zim::entry_index_type i)
+    {
+        resolveChain(i);
+        return finalTarget[i];
+    }
+
 private: // functions
     LoopStatus detectLoopStatus(zim::entry_index_type i) const
     {
@@ -775,14 +1227,61 @@ private: // functions
         }
     }
 
+    // Follow redirections until an entry with known chain depth is found
+    // and memoise the depth and the final target of all entries on the way,
+    // so that every redirection is followed only once.
+    void resolveChain(zim::entry_index_type i)
+    {
+        for ( ; chainDepth[i] == UNKNOWN_DEPTH; i = redirTable[i] )
+        {
+            chain.push_back(i);
+        }
+
+        for ( ; !chain.empty(); chain.pop_back() )
+        {
+            const auto j = chain.back();
+            chainDepth[j] = chainDepth[i] + 1;
+            finalTarget[j] = finalTarget[i];
+            i = j;
+        }
+    }
+
 private: // data
     std::vector<zim::entry_index_type> redirTable;
     std::vector<LoopStatus> loopStatus;
+    std::vector<uint32_t> chainDepth;
+    std::vector<zim::entry_index_type> finalTarget;
+    std::vector<zim::entry_index_type> chain;
 };
 
+void reportRedirectDepths(const RedirectDepthReport& report, ErrorLogger& reporter)
+{
+    reporter.infoMsg("[INFO] Redirect chain lengths:");
+    for ( size_t depth = 0; depth < report.depthHistogram.size(); ++depth ) {
+        if ( report.depthHistogram[depth] != 0 ) {
+            reporter.infoMsg("  " + toStr(depth) + " : " + toStr(report.depthHistogram[depth]) + " redirects");
+        }
+    }
+}
+
+// Returns the path of an entry as given to zimwriterfs (without namespace),
+// or an empty string if the entry isn't content. The content of an archive
+// using the old namespace scheme is in the A (articles) and I (images)
+// namespaces.
+std::string getContentPath(const zim::Archive& archive, const zim::Entry& entry)
+{
+    const auto path = entry.getPath();
+    if ( archive.hasNewNamespaceScheme() )
+        return path;
+    if ( path.size() > 2 && (path[0] == 'A' || path[0] == 'I') && path[1] == '/' )
+        return path.substr(2);
+    return std::string();
+}
+
 } // unnamed namespace
 
-void test_redirect_loop(const zim::Archive& archive, ErrorLogger& reporter) {
+RedirectDepthReport test_redirect_loop(const zim::Archive& archive, ErrorLogger& reporter,
+                                       const ZimCheckOptions& options) {
     reporter.infoMsg("[INFO] Checking for redirect loops...");
 
     RedirectionTable redirTable(archive.getAllEntryCount());
@@ -794,11 +1293,348 @@ void test_redirect_loop(const zim::Archive& archive, ErrorLogger& reporter) {
             redirTable.addItem();
     }
 
+    std::ofstream redirectMap;
+    if ( !options.redirectMapPath.empty() ) {
+        redirectMap.open(options.redirectMapPath);
+        if ( !redirectMap )
+            throw std::runtime_error("Cannot open " + options.redirectMapPath);
+    }
+
+    const bool reportChains = options.enabledTests.isEnabled(TestType::REDIRECT_CHAIN);
+    RedirectDepthReport report;
     for(zim::entry_index_type i = 0; i < redirTable.size(); ++i )
     {
         if(redirTable.isInRedirectionLoop(i)){
             const auto entry = archive.getEntryByPath(i);
             reporter.addMsg(MsgId::REDIRECT_LOOP, {{"entry_path", entry.getPath()}});
+            continue;
+        }
+
+        const size_t depth = redirTable.getChainDepth(i);
+        if ( depth == 0 )
+            continue;
+
+        if ( report.depthHistogram.size() <= depth )
+            report.depthHistogram.resize(depth + 1);
+        ++report.depthHistogram[depth];
+
+        const bool tooLong = reportChains && depth > options.maxRedirectDepth;
+        if ( tooLong || redirectMap.is_open() ) {
+            const auto entry = archive.getEntryByPath(i);
+            const auto target = archive.getEntryByPath(redirTable.getFinalTarget(i));
+            if ( tooLong ) {
+                reporter.addMsg(MsgId::REDIRECT_CHAIN, {{"entry_path", entry.getPath()},
+                                                        {"target_path", target.getPath()},
+                                                        {"depth", toStr(depth)}});
+            }
+            if ( redirectMap.is_open() ) {
+                // Same format as the redirects file of zimwriterfs (which
+                // requires a title). The redirects outside the content
+                // can't be written there.
+                const auto path = getContentPath(archive, entry);
+                const auto targetPath = getContentPath(archive, target);
+                if ( !path.empty() && !targetPath.empty() ) {
+                    const auto title = entry.getTitle();
+                    redirectMap << path << "\t" << (title.empty() ? path : title)
+                                << "\t" << targetPath << "\n";
+                }
+            }
         }
     }
+
+    if ( !report.depthHistogram.empty() ) {
+        reportRedirectDepths(report, reporter);
+    }
+    return report;
+}
+
+namespace
+{
+
+// Clusters holding more data than this (in bytes) must be fully decompressed
+// for accessing their last items, which slows down random access
+// (libzim's default cluster size is 2MiB).
+const size_t OVERSIZED_CLUSTER_SIZE = 8*1024*1024;
+
+// Compression is considered inefficient if it saves less than 10%
+const double INEFFICIENT_COMPRESSION_RATIO = 0.9;
+
+const std::set<std::string> precompressedMimetypes = {
+    "application/gzip", "application/x-bzip2", "application/x-xz",
+    "application/zip", "application/zstd",
+    "audio/aac", "audio/mp4", "audio/mpeg", "audio/ogg", "audio/webm",
+    "font/woff", "font/woff2",
+    "image/avif", "image/gif", "image/jpeg", "image/png", "image/webp",
+    "video/mp4", "video/ogg", "video/webm"
+};
+
+bool isPrecompressedMimetype(const std::string& mimetype)
+{
+    return precompressedMimetypes.count(mimetype.substr(0, mimetype.find(';'))) != 0;
+}
+
+const char* compressionName(int compression)
+{
+    switch(compression) {
+        case 0:
+        case 1: return "none";
+        case 2: return "zip";
+        case 3: return "bzip2";
+        case 4: return "lzma";
+        case 5: return "zstd";
+        default: return "unknown";
+    }
+}
+
+uint64_t readLittleEndian(std::istream& in, size_t byteCount)
+{
+    unsigned char buf[8] = {0};
+    in.read(reinterpret_cast<char*>(buf), byteCount);
+    uint64_t r = 0;
+    while ( byteCount-- )
+        r = (r << 8) | buf[byteCount];
+    return r;
+}
+
+struct ClusterLayout
+{
+    // Filled from the directory entries
+    std::vector<std::pair<zim::blob_index_type, zim::size_type>> blobs;
+    std::set<std::string> precompressedMimetypes;
+    std::unique_ptr<zim::Item> lastItem; // item with the highest blob index
+    std::string compression = "unknown";
+    bool compressed = false;
+
+    // Filled by the worker threads
+    size_t blobCount = 0;
+    size_t storedSize = 0;
+    std::string unknownSizeReason;       // empty if storedSize was read
+    size_t dataSize = 0;
+    double decompressionTime = 0;
+};
+
+const int ZSTD_COMPRESSION = 5;
+
+// Returns the size of the zstd frame starting at the current position of in
+// (0 if it isn't a valid frame). The blocks are skipped using the size in
+// their header, without being decompressed.
+uint64_t readZstdFrameSize(std::istream& in)
+{
+    if ( readLittleEndian(in, 4) != 0xFD2FB528 )
+        return 0;
+    const int descriptor = in.get();
+    if ( !in )
+        return 0;
+
+    const bool singleSegment = descriptor & 0x20;
+    const uint64_t dictionaryIdSizes[] = {0, 1, 2, 4};
+    const uint64_t contentSizeSizes[] = {singleSegment ? 1u : 0u, 2, 4, 8};
+    const uint64_t headerSize = (singleSegment ? 0 : 1)
+                              + dictionaryIdSizes[descriptor & 0x03]
+                              + contentSizeSizes[descriptor >> 6];
+    in.seekg(headerSize, std::ios::cur);
+    uint64_t size = 5 + headerSize;
+    for ( ;; ) {
+        const auto blockHeader = readLittleEndian(in, 3);
+        const auto blockType = (blockHeader >> 1) & 0x03;
+        if ( !in || blockType == 3 )
+            return 0;
+        // An RLE block stores a single byte
+        const auto blockSize = blockType == 1 ? 1 : blockHeader >> 3;
+        in.seekg(blockSize, std::ios::cur);
+        size += 3 + blockSize;
+        if ( blockHeader & 1 )
+            break;
+    }
+    if ( descriptor & 0x04 )
+        size += 4; // content checksum
+    return in ? size : 0;
+}
+
+// Reads the compression and the stored size of a cluster from its header.
+// Returns why the stored size is unknown (if it is).
+std::string readClusterHeader(std::istream& in, zim::offset_type offset,
+                              zim::offset_type fileSize, ClusterLayout& c)
+{
+    in.clear();
+    in.seekg(offset);
+    const int info = in.get();
+    if ( !in )
+        return "invalid cluster";
+
+    c.compression = compressionName(info & 0x0F);
+    c.compressed = (info & 0x0F) > 1;
+    if ( c.compressed ) {
+        if ( (info & 0x0F) != ZSTD_COMPRESSION )
+            return c.compression + " compressed cluster";
+        const auto frameSize = readZstdFrameSize(in);
+        if ( frameSize == 0 || offset + 1 + frameSize > fileSize )
+            return "invalid cluster";
+        c.storedSize = 1 + frameSize;
+        return std::string();
+    }
+
+    // The offset table of an uncompressed cluster gives its exact size
+    // and blob count.
+    const size_t offsetSize = (info & 0x10) ? 8 : 4;
+    const auto tableSize = readLittleEndian(in, offsetSize);
+    if ( !in || tableSize < offsetSize || tableSize % offsetSize != 0 )
+        return "invalid cluster";
+    in.seekg(offset + 1 + tableSize - offsetSize);
+    const auto dataEnd = readLittleEndian(in, offsetSize);
+    if ( !in )
+        return "invalid cluster";
+    c.blobCount = tableSize / offsetSize - 1;
+    c.storedSize = 1 + dataEnd;
+    return std::string();
+}
+
+void analyseClusters(const zim::Archive& archive, const std::string& filename,
+                     std::vector<ClusterLayout>& clusters, int thread_count)
+{
+    // The cluster headers are read from the ZIM file at the offsets given by
+    // libzim. Those of a split archive are offsets in the concatenation of
+    // its parts, so its headers aren't read.
+    std::string failure;
+    if ( archive.isMultiPart() ) {
+        failure = "split archive";
+    } else if ( !std::ifstream(filename, std::ios::binary) ) {
+        failure = "unable to read " + filename;
+    }
+
+    std::atomic<size_t> nextCluster(0);
+    auto worker = [&]() {
+        std::ifstream in;
+        if ( failure.empty() )
+            in.open(filename, std::ios::binary);
+        for ( size_t i = nextCluster++; i < clusters.size(); i = nextCluster++ ) {
+            ClusterLayout& c = clusters[i];
+            c.unknownSizeReason = failure.empty()
+                ? readClusterHeader(in, archive.getClusterOffset(i), archive.getFilesize(), c)
+                : failure;
+
+            if ( c.lastItem ) {
+                // Accessing the last blob forces the decompression of the
+                // whole cluster
+                const auto startTime = Clock::now();
+                try {
+                    c.lastItem->getData();
+                    c.decompressionTime = millisecondsSince(startTime);
+                } catch ( const std::exception& ) {}
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for ( int i = 1; i < thread_count; ++i )
+        threads.emplace_back(worker);
+    worker();
+    for ( auto& t : threads )
+        t.join();
+}
+
+void reportClusterLayout(const ClusterLayoutReport& report, ErrorLogger& reporter)
+{
+    for ( const auto& c : report.compressionStats ) {
+        std::ostringstream ss;
+        ss << std::fixed << std::setprecision(3)
+           << "  " << c.compression << " : " << c.clusterCount << " clusters, "
+           << c.blobCount << " blobs, " << c.storedSize << " bytes stored, "
+           << c.dataSize << " bytes of data, decompression: "
+           << c.decompressionTime << " ms";
+        reporter.infoMsg(ss.str());
+    }
+}
+
+} // unnamed namespace
+
+ClusterLayoutReport test_clusters(const zim::Archive& archive, const std::string& filename,
+                                  ErrorLogger& reporter, int thread_count) {
+    reporter.infoMsg("[INFO] Checking cluster layout...");
+
+    std::vector<ClusterLayout> clusters(archive.getClusterCount());
+    const auto addItem = [&clusters](const zim::Item& item) {
+        ClusterLayout& c = clusters.at(item.getClusterIndex());
+        c.blobs.emplace_back(item.getBlobIndex(), item.getSize());
+        if ( isPrecompressedMimetype(item.getMimetype()) )
+            c.precompressedMimetypes.insert(item.getMimetype());
+        if ( !c.lastItem || c.lastItem->getBlobIndex() < item.getBlobIndex() ) {
+            c.lastItem = std::make_unique<zim::Item>(item);
+            // libzim only gives a direct access to the blobs of the
+            // uncompressed clusters
+            c.compressed = !item.getDirectAccessInformation().isValid();
+            c.compression = c.compressed ? "compressed" : "none";
+        }
+    };
+    for ( const auto& entry : archive.iterEfficient() ) {
+        if ( !entry.isRedirect() )
+            addItem(entry.getItem());
+    }
+    for ( const auto& key : archive.getMetadataKeys() ) {
+        addItem(archive.getMetadataItem(key));
+    }
+
+    analyseClusters(archive, filename, clusters, thread_count);
+
+    std::map<std::string, ClusterStats> stats;
+    for ( size_t i = 0; i < clusters.size(); ++i ) {
+        ClusterLayout& c = clusters[i];
+        // Aliases (and, in old namespace scheme archives, metadata entries)
+        // may refer to the same blob several times
+        std::sort(c.blobs.begin(), c.blobs.end());
+        c.blobs.erase(std::unique(c.blobs.begin(), c.blobs.end()), c.blobs.end());
+        for ( const auto& b : c.blobs )
+            c.dataSize += b.second;
+        c.blobCount = std::max(c.blobCount, c.blobs.size());
+
+        ClusterStats& s = stats[c.compression];
+        s.compression = c.compression;
+        ++s.clusterCount;
+        s.blobCount += c.blobCount;
+        s.storedSize += c.storedSize;
+        s.dataSize += c.dataSize;
+        s.decompressionTime += c.decompressionTime;
+
+        if ( !c.compressed )
+            continue;
+
+        const auto cluster = toStr(i);
+        if ( c.dataSize > OVERSIZED_CLUSTER_SIZE && c.blobCount > 1 ) {
+            reporter.addMsg(MsgId::OVERSIZED_CLUSTER, {{"cluster", cluster},
+                                                       {"compression", c.compression},
+                                                       {"data_size", toStr(c.dataSize)},
+                                                       {"blob_count", toStr(c.blobCount)}});
+        }
+        if ( c.dataSize != 0 && c.storedSize >= c.dataSize * INEFFICIENT_COMPRESSION_RATIO ) {
+            reporter.addMsg(MsgId::INEFFICIENT_COMPRESSION, {{"cluster", cluster},
+                                                             {"compression", c.compression},
+                                                             {"stored_size", toStr(c.storedSize)},
+                                                             {"data_size", toStr(c.dataSize)}});
+        }
+        if ( !c.precompressedMimetypes.empty() ) {
+            std::string mimetypes;
+            for ( const auto& m : c.precompressedMimetypes )
+                mimetypes += (mimetypes.empty() ? "" : ", ") + m;
+            reporter.addMsg(MsgId::PRECOMPRESSED_DATA, {{"cluster", cluster},
+                                                        {"compression", c.compression},
+                                                        {"mimetypes", mimetypes}});
+        }
+    }
+
+    ClusterLayoutReport report;
+    for ( const auto& kv : stats )
+        report.compressionStats.push_back(kv.second);
+    std::map<std::string, size_t> unknownSizeReasons;
+    for ( const auto& c : clusters ) {
+        if ( !c.unknownSizeReason.empty() ) {
+            ++unknownSizeReasons[c.unknownSizeReason];
+            ++report.unknownSizeClusterCount;
+        }
+    }
+    for ( const auto& kv : unknownSizeReasons ) {
+        reporter.addMsg(MsgId::UNKNOWN_CLUSTER_SIZE, {{"count", toStr(kv.second)},
+                                                      {"reason", kv.first}});
+    }
+    reportClusterLayout(report, reporter);
+    return report;
 }
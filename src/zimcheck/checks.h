@@ -4,9 +4,12 @@
 #include <vector>
 #include <iostream>
 #include <bitset>
+#include <map>
 #include <mutex>
+#include <string>
 
 #include <mustache.hpp>
+#include <zim/zim.h>
 
 #include "json_tools.h"
 #include "../progress.h"
@@ -35,6 +38,9 @@ enum class TestType {
     URL_EXTERNAL,
     URL_EMPTY,
     REDIRECT,
+    REDIRECT_CHAIN,
+    UTF8,
+    CLUSTERS,
 
     COUNT
 };
@@ -45,7 +51,13 @@ class EnabledTests {
   public:
     EnabledTests() {}
 
-    void enableAll() { tests.set(); }
+    // Enables all tests except the cluster layout analysis and the redirect
+    // chain report which are only performed on explicit request
+    void enableAll() {
+      tests.set();
+      tests.reset(size_t(TestType::CLUSTERS));
+      tests.reset(size_t(TestType::REDIRECT_CHAIN));
+    }
     void enable(TestType tt) { tests.set(size_t(tt)); }
     bool isEnabled(TestType tt) const { return tests[size_t(tt)]; }
 };
@@ -53,6 +65,70 @@ class EnabledTests {
 struct ZimCheckOptions {
   EnabledTests enabledTests;
   bool quick = false;
+
+  // Number of the most expensive entries and clusters to report
+  // (0 disables the per-entry cost accounting)
+  size_t slowestCount = 0;
+
+  // Redirect chains longer than that are reported. Chains of a few
+  // redirections are common (redirect to a renamed page...) and harmless.
+  size_t maxRedirectDepth = 5;
+
+  // File where the flattened redirect mapping is written (if not empty)
+  std::string redirectMapPath;
+};
+
+// Cost of checking a single item
+struct EntryCost {
+  std::string path;
+  zim::cluster_index_type cluster = 0;
+  size_t size = 0;
+  size_t linkCount = 0;
+  double dataTime = 0;   // milliseconds spent on getting (decompressing) data
+  double checkTime = 0;  // milliseconds spent on checking the item
+};
+
+// Cost of checking all items of a cluster
+struct ClusterCost {
+  zim::cluster_index_type cluster = 0;
+  size_t itemCount = 0;
+  size_t size = 0;
+  size_t linkCount = 0;
+  double dataTime = 0;
+  double checkTime = 0;
+};
+
+// The most expensive entries and clusters (sorted by decreasing checkTime)
+struct ArticleCostReport {
+  std::vector<EntryCost> slowestEntries;
+  std::vector<ClusterCost> slowestClusters;
+};
+
+// Number of redirects by length of their redirection chain
+// (depthHistogram[d] redirects reach an item after d redirections).
+// Redirects in loops aren't counted.
+struct RedirectDepthReport {
+  std::vector<size_t> depthHistogram;
+};
+
+// Aggregated layout information about the clusters using the same
+// compression method
+struct ClusterStats {
+  std::string compression;
+  size_t clusterCount = 0;
+  size_t blobCount = 0;
+  size_t storedSize = 0;         // bytes occupied in the ZIM file
+  size_t dataSize = 0;           // bytes of (uncompressed) item data
+  double decompressionTime = 0;  // milliseconds
+};
+
+struct ClusterLayoutReport {
+  std::vector<ClusterStats> compressionStats; // sorted by compression name
+
+  // Clusters whose stored size couldn't be read from the ZIM file (it is
+  // only read from single-file archives, for uncompressed and zstd
+  // compressed clusters). It counts as 0 in the stats.
+  size_t unknownSizeClusterCount = 0;
 };
 
 enum class MsgId
@@ -68,13 +144,23 @@ enum class MsgId
   EXTERNAL_LINK,
   REDUNDANT_ITEMS,
   REDIRECT_LOOP,
-  MISSING_FAVICON
+  MISSING_FAVICON,
+  REDIRECT_CHAIN,
+  INVALID_UTF8_TITLE,
+  INVALID_UTF8_CONTENT,
+  OVERSIZED_CLUSTER,
+  INEFFICIENT_COMPRESSION,
+  PRECOMPRESSED_DATA,
+  UNKNOWN_CLUSTER_SIZE
 };
 
 using MsgParams = kainjow::mustache::object;
 
 JSON::OutputStream& operator<<(JSON::OutputStream& out, TestType check);
 JSON::OutputStream& operator<<(JSON::OutputStream& out, EnabledTests checks);
+JSON::OutputStream& operator<<(JSON::OutputStream& out, const ArticleCostReport& report);
+JSON::OutputStream& operator<<(JSON::OutputStream& out, const RedirectDepthReport& report);
+JSON::OutputStream& operator<<(JSON::OutputStream& out, const ClusterLayoutReport& report);
 
 class ErrorLogger {
   private:
@@ -120,11 +206,22 @@ class ErrorLogger {
 
 void test_checksum(zim::Archive& archive, ErrorLogger& reporter);
 bool test_integrity(const std::string& filename, ErrorLogger& reporter);
-void test_metadata(const zim::Archive& archive, ErrorLogger& reporter);
+void test_metadata(const zim::Archive& archive, ErrorLogger& reporter, int thread_count=1);
+
+// Counts the items of the archive by MIME type, as the Counter metadata
+// does: the items of the C namespace or, in old namespace scheme archives,
+// of the content namespaces (-, A, I and J). allNamespaces counts the items
+// of the other namespaces (metadata, indexes...) of old namespace scheme
+// archives too, as some of their writers did.
+std::map<std::string, size_t> countItemsByMimeType(const zim::Archive& archive, bool allNamespaces=false,
+                                                   int thread_count=1);
 void test_favicon(const zim::Archive& archive, ErrorLogger& reporter);
 void test_mainpage(const zim::Archive& archive, ErrorLogger& reporter);
-void test_articles(const zim::Archive& archive, ErrorLogger& reporter, ProgressBar& progress,
+ArticleCostReport test_articles(const zim::Archive& archive, ErrorLogger& reporter, ProgressBar& progress,
                    const ZimCheckOptions& options, int thread_count=1);
-void test_redirect_loop(const zim::Archive& archive, ErrorLogger& reporter);
+RedirectDepthReport test_redirect_loop(const zim::Archive& archive, ErrorLogger& reporter,
+                                       const ZimCheckOptions& options=ZimCheckOptions());
+ClusterLayoutReport test_clusters(const zim::Archive& archive, const std::string& filename,
+                                  ErrorLogger& reporter, int thread_count=1);
 
 #endif
@@ -67,7 +67,13 @@ Options:
  -H --help            Displays Help
  -V --version         Displays software version
  -L --redirect_loop   Checks for the existence of redirect loops
+ -T --utf8            UTF-8 validity of titles and text items
+ -K --clusters        Cluster layout analysis (not included in --all)
+ -D --redirect_chain  Redirect chains longer than --redirect_depth (with -L, not included in --all)
  -W=<nb_thread> --threads=<nb_thread>  count of threads to utilize [default: 1]
+ -S=<count> --slowest=<count>  report the <count> most expensive entries and clusters [default: 0]
+ --redirect_depth=<depth>  maximal redirect chain length accepted by -D [default: 5]
+ --redirect_map=<file>  write the flattened redirect mapping to <file> (with -L)
 
 Examples:
  zimcheck -A wikipedia.zim
@@ -177,10 +183,37 @@ int zimcheck(const Options& args)
         } else if (arg.first == "--redirect_loop" && arg.second.asBool()) {
             enabled_tests.enable(TestType::REDIRECT);
             no_args = false;
+        } else if (arg.first == "--redirect_chain" && arg.second.asBool()) {
+            enabled_tests.enable(TestType::REDIRECT_CHAIN);
+            no_args = false;
+        } else if (arg.first == "--utf8" && arg.second.asBool()) {
+            enabled_tests.enable(TestType::UTF8);
+            no_args = false;
+        } else if (arg.first == "--clusters" && arg.second.asBool()) {
+            enabled_tests.enable(TestType::CLUSTERS);
+            no_args = false;
         } else if (arg.first == "--json") {
             json = arg.second.asBool();
         } else if (arg.first == "--threads") {
             thread_count = arg.second.asLong();
+        } else if (arg.first == "--slowest") {
+            const long count = arg.second.asLong();
+            if (count < 0) {
+                std::cerr << "--slowest must not be negative" << std::endl;
+                std::cout << USAGE << std::endl;
+                return 1;
+            }
+            options.slowestCount = count;
+        } else if (arg.first == "--redirect_depth") {
+            const long depth = arg.second.asLong();
+            if (depth < 0) {
+                std::cerr << "--redirect_depth must not be negative" << std::endl;
+                std::cout << USAGE << std::endl;
+                return 1;
+            }
+            options.maxRedirectDepth = depth;
+        } else if (arg.first == "--redirect_map" && arg.second.isString()) {
+            options.redirectMapPath = arg.second.asString();
         } else if (arg.first == "ZIMFILE" && arg.second.isString()) {
             filename = arg.second.asString();
         } else if (arg.first == "--version" && arg.second.asBool()) {
@@ -242,7 +275,7 @@ int zimcheck(const Options& args)
             //Test 2: Metadata Entries:
             //The file is searched for the compulsory metadata entries.
             if(enabled_tests.isEnabled(TestType::METADATA))
-                test_metadata(archive, error);
+                test_metadata(archive, error, thread_count);
 
             //Test 3: Test for Favicon.
             if(enabled_tests.isEnabled(TestType::FAVICON))
@@ -253,6 +286,13 @@ int zimcheck(const Options& args)
             if(enabled_tests.isEnabled(TestType::MAIN_PAGE))
                 test_mainpage(archive, error);
 
+            //Test 5: Cluster layout
+            //Performed before reading the articles so that the clusters
+            //aren't in libzim's cache when their decompression is timed.
+            ClusterLayoutReport clusterReport;
+            if(enabled_tests.isEnabled(TestType::CLUSTERS))
+                clusterReport = test_clusters(archive, filename, error, thread_count);
+
             /* Now we want to avoid to loop on the tests but on the article.
              *
              * If we loop of the tests we will have :
@@ -275,16 +315,28 @@ int zimcheck(const Options& args)
              * }
              */
 
+            ArticleCostReport costReport;
             if ( enabled_tests.isEnabled(TestType::URL_INTERNAL) ||
                  enabled_tests.isEnabled(TestType::URL_EXTERNAL) ||
                  enabled_tests.isEnabled(TestType::REDUNDANT) ||
-                 enabled_tests.isEnabled(TestType::EMPTY) )
-              test_articles(archive, error, progress, options, thread_count);
+                 enabled_tests.isEnabled(TestType::EMPTY) ||
+                 enabled_tests.isEnabled(TestType::UTF8) )
+              costReport = test_articles(archive, error, progress, options, thread_count);
 
+            RedirectDepthReport redirectReport;
             if ( enabled_tests.isEnabled(TestType::REDIRECT))
-                test_redirect_loop(archive, error);
+                redirectReport = test_redirect_loop(archive, error, options);
 
             error.endLogStream();
+
+            if ( options.slowestCount != 0 )
+                error.addInfo("slowest", costReport);
+
+            if ( !redirectReport.depthHistogram.empty() )
+                error.addInfo("redirect_depths", redirectReport);
+
+            if ( enabled_tests.isEnabled(TestType::CLUSTERS) )
+                error.addInfo("clusters", clusterReport);
         }
         else
         {
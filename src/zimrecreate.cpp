@@ -31,6 +31,22 @@
 #include "tools.h"
 #include "version.h"
 
+// Rewrites all the (quoted) links to the old namespaces in a single pass
+const MultiStringReplacer& getNamespaceLinkRewriter()
+{
+  static const MultiStringReplacer rewriter([] {
+    MultiStringReplacer::Replacements replacements;
+    for (std::string prefix: {"'", "\""}) {
+      for (auto ns : {'A','I','J','-'}) {
+        replacements.emplace_back(prefix+"../../"+ns+"/", prefix+"../");
+        replacements.emplace_back(prefix+"../"+ns+"/", prefix);
+      }
+    }
+    return replacements;
+  }());
+  return rewriter;
+}
+
 /**
  * A PatchItem. This patch html and css content to remove the namespcae from the links.
  */
@@ -71,22 +87,17 @@ class PatchItem : public zim::writer::Item
             return std::unique_ptr<zim::writer::ContentProvider>(new ItemProvider(item));
         }
 
-        std::string content = item.getData();
         // This is a really poor url rewriting to remove the starting "../<NS>/"
         // and replace the "../../<NS/" by "../" :
-        // - Performance may be better
         // - We only fix links in articles in "root" path (`foo.html`) and in one subdirectory (`bar/foo.hmtl`)
         //   Deeper articles are not fixed (`bar/baz/foo.html`).
         // - We may change content starting by `'../A/` even if they are not links
         // - We don't handle links where we go upper in the middle of the link : `../foo/../I/image.png`
         // - ...
         // However, this should patch most of the links in our zim files.
-        for (std::string prefix: {"'", "\""}) {
-          for (auto ns : {'A','I','J','-'}) {
-            replaceStringInPlace(content, prefix+"../../"+ns+"/", prefix+"../");
-            replaceStringInPlace(content, prefix+"../"+ns+"/", prefix);
-          }
-        }
+        const zim::Blob data = item.getData();
+        const std::string content = getNamespaceLinkRewriter().replace(
+            std::string_view(data.data(), data.size()));
         return std::unique_ptr<zim::writer::ContentProvider>(new zim::writer::StringProvider(content));
     }
 
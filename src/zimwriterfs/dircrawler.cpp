@@ -0,0 +1,331 @@
+#include "dircrawler.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+
+struct DirectoryCrawler::Directory
+{
+  Directory(DIR* _dir, std::string _path)
+    : dir(_dir)
+    , path(std::move(_path))
+  {}
+
+  ~Directory() { closedir(dir); }
+
+  Directory(const Directory&) = delete;
+  Directory& operator=(const Directory&) = delete;
+
+  int fd() const { return dirfd(dir); }
+
+  DIR* const dir;
+  const std::string path;
+};
+
+namespace
+{
+
+// d_type of a dirent corresponding to the st_mode of a stat
+unsigned char direntType(mode_t mode)
+{
+  switch (mode & S_IFMT) {
+    case S_IFREG:  return DT_REG;
+    case S_IFDIR:  return DT_DIR;
+    case S_IFLNK:  return DT_LNK;
+    case S_IFBLK:  return DT_BLK;
+    case S_IFCHR:  return DT_CHR;
+    case S_IFIFO:  return DT_FIFO;
+    case S_IFSOCK: return DT_SOCK;
+    default:       return DT_UNKNOWN;
+  }
+}
+
+// strerror() isn't thread-safe
+std::string errorMessage(int err)
+{
+  return std::error_code(err, std::generic_category()).message();
+}
+
+} // unnamed namespace
+
+bool DirectoryCrawler::DepthFirstOrder::operator()(const std::string& a,
+                                                   const std::string& b) const
+{
+  const size_t n = std::min(a.size(), b.size());
+  for (size_t i = 0; i < n; ++i) {
+    if ( a[i] != b[i] ) {
+      if ( a[i] == '/' || b[i] == '/' )
+        return a[i] == '/';
+      return static_cast<unsigned char>(a[i]) < static_cast<unsigned char>(b[i]);
+    }
+  }
+  return a.size() < b.size();
+}
+
+DirectoryCrawler::DirectoryCrawler(const std::string& _rootPath,
+                                   unsigned threadCount,
+                                   size_t _queueCapacity)
+  : rootPath(_rootPath)
+  , queueCapacity(_queueCapacity)
+  , entries(_queueCapacity)
+{
+  const auto root = std::make_shared<Listing>();
+  tasks.emplace("", Task{nullptr, root});
+  releaseStack.emplace_back(root, 0);
+  awaitedListing = root;
+
+  threadCount = std::max(threadCount, 1u);
+  for (unsigned i = 0; i < threadCount; ++i) {
+    threads.emplace_back([this]() { this->crawl(); });
+  }
+}
+
+DirectoryCrawler::~DirectoryCrawler()
+{
+  stop();
+}
+
+bool DirectoryCrawler::next(Entry& entry)
+{
+  if ( entries.pop(entry) )
+    return true;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  if ( error ) {
+    const auto e = error;
+    error = nullptr;
+    std::rethrow_exception(e);
+  }
+  return false;
+}
+
+void DirectoryCrawler::stop()
+{
+  stopped = true;
+  entries.close();
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    taskCv.notify_all();
+  }
+  for (auto& thread : threads) {
+    if ( thread.joinable() ) {
+      thread.join();
+    }
+  }
+}
+
+void DirectoryCrawler::crawl()
+{
+  try {
+    std::string path;
+    Task task;
+    while ( getTask(path, task) ) {
+      readDirectory(path, task);
+      task = Task(); // closes the parent directory if it was its last child
+    }
+  } catch (...) {
+    fail();
+  }
+}
+
+void DirectoryCrawler::fail()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  if ( !error )
+    error = std::current_exception();
+  stopped = true;
+  entries.close();
+  taskCv.notify_all();
+}
+
+bool DirectoryCrawler::getTask(std::string& path, Task& task)
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  taskCv.wait(lock, [this]() {
+    return stopped || finished
+        || (!tasks.empty() && (readEntryCount < queueCapacity
+                               || tasks.begin()->second.listing == awaitedListing));
+  });
+  if ( stopped || finished )
+    return false;
+
+  const auto first = tasks.begin();
+  path = first->first;
+  task = std::move(first->second);
+  tasks.erase(first);
+  return true;
+}
+
+void DirectoryCrawler::complete(Listing& listing,
+                                std::vector<Listing::Item> items,
+                                std::vector<std::pair<std::string, Task>> subdirectories)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& subdirectory : subdirectories) {
+      tasks.emplace(std::move(subdirectory));
+    }
+    readEntryCount += items.size();
+    listing.items = std::move(items);
+    listing.complete = true;
+  }
+  release();
+}
+
+void DirectoryCrawler::release()
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  if ( releasing ) {
+    // The releasing thread will take care of the completed listing
+    releaseAgain = true;
+    return;
+  }
+
+  releasing = true;
+  do {
+    releaseAgain = false;
+    while ( !releaseStack.empty() ) {
+      Listing& listing = *releaseStack.back().first;
+      if ( !listing.complete ) {
+        awaitedListing = releaseStack.back().first;
+        break;
+      }
+      size_t& position = releaseStack.back().second;
+      if ( position == listing.items.size() ) {
+        releaseStack.pop_back();
+        continue;
+      }
+
+      Listing::Item& item = listing.items[position++];
+      if ( --readEntryCount + 1 == queueCapacity ) {
+        taskCv.notify_all();
+      }
+      if ( item.subdirectory ) {
+        releaseStack.emplace_back(std::move(item.subdirectory), 0);
+        continue;
+      }
+
+      Entry entry = std::move(item.entry);
+      lock.unlock();
+      const bool pushed = entries.push(std::move(entry));
+      lock.lock();
+      if ( !pushed ) {
+        releasing = false;
+        return;
+      }
+    }
+  } while ( releaseAgain );
+  releasing = false;
+
+  if ( releaseStack.empty() ) {
+    finished = true;
+    entries.close();
+  }
+  taskCv.notify_all();
+}
+
+void DirectoryCrawler::readDirectory(const std::string& path, const Task& task)
+{
+  std::vector<Listing::Item> items;
+  std::vector<std::pair<std::string, Task>> subdirectories;
+  const auto addEntry = [&items](Entry::Type type, std::string entryPath,
+                                 std::string message = "") {
+    items.push_back(Listing::Item{Entry{type, std::move(entryPath), std::move(message)}, nullptr});
+  };
+
+  int fd;
+  if ( task.parent ) {
+    const size_t nameOffset = task.parent->path.empty() ? 0 : task.parent->path.size() + 1;
+    fd = openat(task.parent->fd(), path.c_str() + nameOffset,
+                O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+  } else {
+    fd = open(rootPath.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+  }
+  if ( fd < 0 ) {
+    addEntry(Entry::Type::DIRECTORY_ERROR, path, errorMessage(errno));
+    complete(*task.listing, std::move(items), std::move(subdirectories));
+    return;
+  }
+
+  DIR* const dir = fdopendir(fd);
+  if ( dir == NULL ) {
+    const int err = errno;
+    close(fd);
+    addEntry(Entry::Type::DIRECTORY_ERROR, path, errorMessage(err));
+    complete(*task.listing, std::move(items), std::move(subdirectories));
+    return;
+  }
+
+  const auto directory = std::make_shared<Directory>(dir, path);
+  addEntry(Entry::Type::DIRECTORY, path);
+
+  const std::string prefix = path.empty() ? "" : path + '/';
+  struct dirent* entry;
+  while ( (errno = 0, entry = readdir(dir)) != NULL ) {
+    const char* const name = entry->d_name;
+
+    /* Ignore this system navigation virtual directories */
+    if ( strcmp(name, ".") == 0 || strcmp(name, "..") == 0 )
+      continue;
+
+    std::string entryPath = prefix + name;
+    unsigned char type = entry->d_type;
+    if ( type == DT_UNKNOWN ) {
+      // Many network filesystems don't report the type of the entries
+      struct stat s;
+      if ( fstatat(directory->fd(), name, &s, AT_SYMLINK_NOFOLLOW) != 0 ) {
+        addEntry(Entry::Type::STAT_ERROR, std::move(entryPath), errorMessage(errno));
+        continue;
+      }
+      type = direntType(s.st_mode);
+    }
+
+    switch (type) {
+      case DT_REG:
+        addEntry(Entry::Type::FILE, std::move(entryPath));
+        break;
+      case DT_LNK:
+        addEntry(Entry::Type::SYMLINK, std::move(entryPath));
+        break;
+      case DT_DIR: {
+        const auto listing = std::make_shared<Listing>();
+        items.push_back(Listing::Item{Entry{Entry::Type::DIRECTORY, entryPath, ""}, listing});
+        subdirectories.emplace_back(std::move(entryPath), Task{directory, listing});
+        break;
+      }
+      case DT_BLK:
+        addEntry(Entry::Type::UNSUPPORTED, std::move(entryPath), "this is a block device");
+        break;
+      case DT_CHR:
+        addEntry(Entry::Type::UNSUPPORTED, std::move(entryPath), "this is a character device");
+        break;
+      case DT_FIFO:
+        addEntry(Entry::Type::UNSUPPORTED, std::move(entryPath), "this is a named pipe");
+        break;
+      case DT_SOCK:
+        addEntry(Entry::Type::UNSUPPORTED, std::move(entryPath), "this is a UNIX domain socket");
+        break;
+      default:
+        addEntry(Entry::Type::UNSUPPORTED, std::move(entryPath), "no clue what kind of file it is");
+        break;
+    }
+    if ( stopped )
+      return;
+  }
+  const int readError = errno;
+
+  // The order of readdir() depends on the filesystem
+  std::sort(items.begin() + 1, items.end(),
+            [](const Listing::Item& a, const Listing::Item& b) {
+              return a.entry.path < b.entry.path;
+            });
+  if ( readError != 0 ) {
+    addEntry(Entry::Type::DIRECTORY_ERROR, path, errorMessage(readError));
+  }
+  complete(*task.listing, std::move(items), std::move(subdirectories));
+}
@@ -0,0 +1,141 @@
+#ifndef OPENZIM_ZIMWRITERFS_DIRCRAWLER_H
+#define OPENZIM_ZIMWRITERFS_DIRCRAWLER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "queue.h"
+
+/**
+ * DirectoryCrawler walks a directory tree with several threads and
+ * delivers the entries found in it to a single consumer (through next()).
+ *
+ * The directories waiting to be read are kept in depth-first order and
+ * every crawler thread takes the first one, so that the reading follows
+ * the order of the output. Directories are opened and entries of unknown
+ * type are stat'ed relative to the file descriptor of their parent
+ * (openat()/fstatat()) so that the kernel doesn't resolve the full path of
+ * every entry.
+ *
+ * The entries of a directory are sorted by name and the directories are
+ * released, once read, in depth-first order: a directory, its entries and
+ * the subtree of each subdirectory at its place among them. The order of
+ * the entries is thus the same whatever the number of threads.
+ *
+ * The crawl doesn't run ahead of the consumer by more than queueCapacity
+ * entries (plus the entries of the directory being read).
+ */
+class DirectoryCrawler
+{
+public: // types
+  struct Entry
+  {
+    enum class Type {
+      DIRECTORY,        // a directory which is being read
+      FILE,             // a regular file
+      SYMLINK,
+      UNSUPPORTED,      // a device, a pipe, ... (message tells what it is)
+      STAT_ERROR,       // an entry of unknown type that couldn't be stat'ed
+      DIRECTORY_ERROR   // a directory that couldn't be opened or read
+    };
+
+    Type type = Type::FILE;
+    std::string path;     // relative to the root directory ("" for the root)
+    std::string message;  // for UNSUPPORTED and *_ERROR entries
+  };
+
+public: // functions
+  // Starts crawling rootPath with threadCount threads
+  DirectoryCrawler(const std::string& rootPath, unsigned threadCount,
+                   size_t queueCapacity = 4096);
+  ~DirectoryCrawler();
+
+  DirectoryCrawler(const DirectoryCrawler&) = delete;
+  DirectoryCrawler& operator=(const DirectoryCrawler&) = delete;
+
+  // Gets the next entry. Returns false when the whole tree has been
+  // crawled. An exception thrown by a crawler thread is rethrown here.
+  bool next(Entry& entry);
+
+  // Stops the crawl (next() returns false afterwards)
+  void stop();
+
+private: // types
+  struct Directory;
+
+  // The entries of a directory, sorted once it has been read. A
+  // subdirectory is represented by its own listing.
+  struct Listing
+  {
+    struct Item
+    {
+      Entry entry;
+      std::shared_ptr<Listing> subdirectory;
+    };
+
+    std::vector<Item> items;
+    bool complete = false;
+  };
+
+  // A directory to read
+  struct Task
+  {
+    std::shared_ptr<Directory> parent;  // null for the root directory
+    std::shared_ptr<Listing> listing;
+  };
+
+  // Depth-first order of the paths ('/' sorts before any other character)
+  struct DepthFirstOrder
+  {
+    bool operator()(const std::string& a, const std::string& b) const;
+  };
+
+private: // functions
+  void crawl();
+  bool getTask(std::string& path, Task& task);
+  void readDirectory(const std::string& path, const Task& task);
+  void complete(Listing& listing, std::vector<Listing::Item> items,
+                std::vector<std::pair<std::string, Task>> subdirectories);
+  void release();
+  void fail();
+
+private: // data
+  const std::string rootPath;
+  const size_t queueCapacity;
+  std::vector<std::thread> threads;
+  BoundedQueue<Entry> entries;
+
+  std::atomic<bool> stopped{false};
+
+  // Protects everything below
+  std::mutex mutex;
+  std::condition_variable taskCv;
+
+  // Directories waiting to be read, indexed by path
+  std::map<std::string, Task, DepthFirstOrder> tasks;
+
+  // The listings being released and the position in each of them
+  std::vector<std::pair<std::shared_ptr<Listing>, size_t>> releaseStack;
+
+  // The listing that the release waits for. Its directory is read even if
+  // too many entries are waiting to be released.
+  std::shared_ptr<Listing> awaitedListing;
+
+  // Entries of the read directories that haven't been released yet
+  size_t readEntryCount = 0;
+
+  bool releasing = false;      // a thread is releasing entries
+  bool releaseAgain = false;   // a listing was completed meanwhile
+  bool finished = false;       // the whole tree has been released
+
+  std::exception_ptr error;
+};
+
+#endif  // OPENZIM_ZIMWRITERFS_DIRCRAWLER_H
@@ -0,0 +1,70 @@
+#ifndef OPENZIM_ZIMWRITERFS_QUEUE_H
+#define OPENZIM_ZIMWRITERFS_QUEUE_H
+
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+
+/**
+ * A FIFO queue of limited capacity shared by producer and consumer threads.
+ *
+ * push() blocks while the queue is full and pop() blocks while it is empty,
+ * until close() is called. After that, push() fails and pop() returns the
+ * remaining elements and then fails.
+ */
+template<class T>
+class BoundedQueue
+{
+public: // functions
+  explicit BoundedQueue(size_t _capacity)
+    : capacity(_capacity)
+  {}
+
+  BoundedQueue(const BoundedQueue&) = delete;
+  BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+  // Returns false (and drops the element) if the queue is closed
+  bool push(T element)
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    notFull.wait(lock, [this]() { return closed || elements.size() < capacity; });
+    if ( closed )
+      return false;
+
+    elements.push(std::move(element));
+    notEmpty.notify_one();
+    return true;
+  }
+
+  // Returns false if the queue is closed and empty
+  bool pop(T& element)
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    notEmpty.wait(lock, [this]() { return closed || !elements.empty(); });
+    if ( elements.empty() )
+      return false;
+
+    element = std::move(elements.front());
+    elements.pop();
+    notFull.notify_one();
+    return true;
+  }
+
+  void close()
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    closed = true;
+    notFull.notify_all();
+    notEmpty.notify_all();
+  }
+
+private: // data
+  const size_t capacity;
+  std::queue<T> elements;
+  bool closed = false;
+  std::mutex mutex;
+  std::condition_variable notFull;
+  std::condition_variable notEmpty;
+};
+
+#endif  // OPENZIM_ZIMWRITERFS_QUEUE_H
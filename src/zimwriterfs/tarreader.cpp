@@ -0,0 +1,288 @@
+#include "tarreader.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+#include "../tools.h"
+
+namespace
+{
+
+const size_t BLOCK_SIZE = 512;
+
+// Bigger GNU long names and pax headers are certainly garbage
+const uint64_t MAX_EXTENSION_SIZE = 1024*1024;
+
+// Offsets and sizes of the fields of a ustar header
+const size_t NAME_OFFSET = 0,       NAME_SIZE = 100;
+const size_t SIZE_OFFSET = 124,     SIZE_SIZE = 12;
+const size_t CHECKSUM_OFFSET = 148, CHECKSUM_SIZE = 8;
+const size_t TYPE_OFFSET = 156;
+const size_t LINK_OFFSET = 157,     LINK_SIZE = 100;
+const size_t MAGIC_OFFSET = 257;
+const size_t PREFIX_OFFSET = 345,   PREFIX_SIZE = 155;
+
+uint64_t paddingOf(uint64_t size)
+{
+  return (BLOCK_SIZE - size % BLOCK_SIZE) % BLOCK_SIZE;
+}
+
+// A NUL terminated (unless it fills it) string field
+std::string stringField(const char* field, size_t size)
+{
+  return std::string(field, std::find(field, field + size, '\0'));
+}
+
+// An octal number, or a base-256 one (GNU extension for big numbers)
+uint64_t numberField(const char* field, size_t size)
+{
+  uint64_t value = 0;
+  if (static_cast<unsigned char>(field[0]) & 0x80) {
+    value = static_cast<unsigned char>(field[0]) & 0x7f;
+    for (size_t i = 1; i < size; ++i) {
+      value = (value << 8) | static_cast<unsigned char>(field[i]);
+    }
+    return value;
+  }
+
+  size_t i = 0;
+  while (i < size && field[i] == ' ')
+    ++i;
+  for (; i < size && field[i] != '\0' && field[i] != ' '; ++i) {
+    if (field[i] < '0' || field[i] > '7')
+      throw std::runtime_error("Invalid number in tar header");
+    value = value * 8 + (field[i] - '0');
+  }
+  return value;
+}
+
+uint64_t decimalNumber(const std::string& str)
+{
+  if (str.empty() || str.size() > 19
+      || !std::all_of(str.begin(), str.end(), [](char c) { return c >= '0' && c <= '9'; }))
+    throw std::runtime_error("Invalid number in pax header of tar archive");
+  return std::stoull(str);
+}
+
+bool isValidChecksum(const char* block)
+{
+  const uint64_t expected = numberField(block + CHECKSUM_OFFSET, CHECKSUM_SIZE);
+  // The checksum field counts as spaces. Some old archivers summed signed
+  // chars.
+  uint64_t unsignedSum = 0;
+  int64_t signedSum = 0;
+  for (size_t i = 0; i < BLOCK_SIZE; ++i) {
+    const bool inChecksum = i >= CHECKSUM_OFFSET && i < CHECKSUM_OFFSET + CHECKSUM_SIZE;
+    const char c = inChecksum ? ' ' : block[i];
+    unsignedSum += static_cast<unsigned char>(c);
+    signedSum += static_cast<signed char>(c);
+  }
+  return expected == unsignedSum || int64_t(expected) == signedSum;
+}
+
+// Makes path relative to the root of the archive, without "." nor ".."
+// segments. Returns false if it climbs out of the root.
+bool normalizePath(const std::string& path, std::string& normalized)
+{
+  std::string result;
+  for (size_t start = 0; start <= path.size(); ) {
+    const size_t end = std::min(path.find('/', start), path.size());
+    const std::string segment = path.substr(start, end - start);
+    if (segment == "..") {
+      if (result.empty())
+        return false;
+      const auto slash = result.rfind('/');
+      result.resize(slash == std::string::npos ? 0 : slash);
+    } else if (!segment.empty() && segment != ".") {
+      result += result.empty() ? segment : "/" + segment;
+    }
+    start = end + 1;
+  }
+  normalized = result;
+  return true;
+}
+
+// Pax extended header records: "<length> <key>=<value>\n"
+template<class F>
+void forEachPaxRecord(const std::string& data, F f)
+{
+  size_t pos = 0;
+  while (pos < data.size()) {
+    const size_t space = data.find(' ', pos);
+    if (space == std::string::npos)
+      throw std::runtime_error("Invalid pax header in tar archive");
+
+    const size_t length = decimalNumber(data.substr(pos, space - pos));
+    const size_t equal = data.find('=', space);
+    if (length == 0 || pos + length > data.size() || equal >= pos + length
+        || data[pos + length - 1] != '\n')
+      throw std::runtime_error("Invalid pax header in tar archive");
+
+    f(data.substr(space + 1, equal - space - 1),
+      data.substr(equal + 1, pos + length - 1 - equal - 1));
+    pos += length;
+  }
+}
+
+} // unnamed namespace
+
+TarReader::TarReader(std::istream& _in)
+  : in(_in)
+{}
+
+bool TarReader::next(Member& member)
+{
+  skip(remaining + padding);
+  remaining = padding = 0;
+
+  // Attributes of the member set by the extension headers preceding it
+  std::string longPath, longLinkTarget;
+  bool hasPaxSize = false;
+  uint64_t paxSize = 0;
+
+  char block[BLOCK_SIZE];
+  for (;;) {
+    if (!readBlock(block)
+        || std::all_of(block, block + BLOCK_SIZE, [](char c) { return c == '\0'; })) {
+      return false;
+    }
+    if (!isValidChecksum(block)) {
+      throw std::runtime_error("Invalid tar header (wrong checksum)");
+    }
+
+    const char type = block[TYPE_OFFSET];
+    const uint64_t headerSize = numberField(block + SIZE_OFFSET, SIZE_SIZE);
+    switch (type) {
+      case 'L':
+        longPath = stringField(readExtension(headerSize).c_str(), headerSize);
+        continue;
+      case 'K':
+        longLinkTarget = stringField(readExtension(headerSize).c_str(), headerSize);
+        continue;
+      case 'x':
+        forEachPaxRecord(readExtension(headerSize), [&](const std::string& key, const std::string& value) {
+          if (key == "path") {
+            longPath = value;
+          } else if (key == "linkpath") {
+            longLinkTarget = value;
+          } else if (key == "size") {
+            hasPaxSize = true;
+            paxSize = decimalNumber(value);
+          }
+        });
+        continue;
+      case 'g':
+        skip(headerSize + paddingOf(headerSize));
+        continue;
+    }
+
+    const uint64_t size = hasPaxSize ? paxSize : headerSize;
+    // The size of links is meaningless: they have no content
+    const bool hasContent = type != '1' && type != '2';
+    std::string path = longPath;
+    if (path.empty()) {
+      path = stringField(block + NAME_OFFSET, NAME_SIZE);
+      const std::string prefix = stringField(block + PREFIX_OFFSET, PREFIX_SIZE);
+      if (memcmp(block + MAGIC_OFFSET, "ustar", 6) == 0 && !prefix.empty()) {
+        path = prefix + "/" + path;
+      }
+    }
+
+    member = Member();
+    if (!normalizePath(path, member.path)) {
+      std::cerr << "Skip tar member " << path
+                << ": points outside of the root of the archive" << std::endl;
+      if (hasContent) {
+        skip(size + paddingOf(size));
+      }
+      longPath.clear();
+      longLinkTarget.clear();
+      hasPaxSize = false;
+      continue;
+    }
+    member.linkTarget = !longLinkTarget.empty() ? longLinkTarget
+                                                : stringField(block + LINK_OFFSET, LINK_SIZE);
+
+    switch (type) {
+      case '0': case '\0': case '7':
+        member.type = Member::Type::FILE;
+        break;
+      case '1':
+        member.type = Member::Type::HARDLINK;
+        // Left as is if it climbs out of the root: it is rejected when
+        // the link is resolved
+        normalizePath(member.linkTarget, member.linkTarget);
+        break;
+      case '2':
+        member.type = Member::Type::SYMLINK;
+        break;
+      case '5':
+        member.type = Member::Type::DIRECTORY;
+        break;
+      default:
+        member.type = Member::Type::OTHER;
+        break;
+    }
+
+    if (hasContent) {
+      remaining = size;
+      padding = paddingOf(size);
+    }
+    if (member.type == Member::Type::FILE) {
+      member.size = size;
+    }
+    return true;
+  }
+}
+
+size_t TarReader::read(char* buffer, size_t size)
+{
+  const size_t count = std::min<uint64_t>(size, remaining);
+  in.read(buffer, count);
+  if (size_t(in.gcount()) != count) {
+    throw std::runtime_error("Truncated tar archive");
+  }
+  remaining -= count;
+  return count;
+}
+
+// Returns false at the end of the stream
+bool TarReader::readBlock(char* block)
+{
+  in.read(block, BLOCK_SIZE);
+  if (in.gcount() == 0 && in.eof()) {
+    return false;
+  }
+  if (size_t(in.gcount()) != BLOCK_SIZE) {
+    throw std::runtime_error("Truncated tar archive");
+  }
+  return true;
+}
+
+// Reads the content of an extension header (long name, pax attributes)
+std::string TarReader::readExtension(uint64_t size)
+{
+  if (size > MAX_EXTENSION_SIZE) {
+    throw std::runtime_error(Formatter() << "Invalid tar extension header of " << size << " bytes");
+  }
+  std::string data(size, '\0');
+  in.read(&data[0], size);
+  if (uint64_t(in.gcount()) != size) {
+    throw std::runtime_error("Truncated tar archive");
+  }
+  skip(paddingOf(size));
+  return data;
+}
+
+void TarReader::skip(uint64_t size)
+{
+  if (size == 0)
+    return;
+
+  in.ignore(size);
+  if (uint64_t(in.gcount()) != size) {
+    throw std::runtime_error("Truncated tar archive");
+  }
+}
@@ -0,0 +1,64 @@
+#ifndef OPENZIM_ZIMWRITERFS_TARREADER_H
+#define OPENZIM_ZIMWRITERFS_TARREADER_H
+
+#include <cstdint>
+#include <istream>
+#include <string>
+
+/**
+ * TarReader reads the members of a tar archive sequentially from a stream
+ * (which doesn't need to be seekable: the standard input, the output of a
+ * decompressor, ...).
+ *
+ * The ustar format is supported, with the GNU (././@LongLink) and pax
+ * extensions used for long paths and big files.
+ */
+class TarReader
+{
+public: // types
+  struct Member
+  {
+    enum class Type {
+      FILE,
+      DIRECTORY,
+      SYMLINK,
+      HARDLINK,
+      OTHER         // a device, a fifo, ...
+    };
+
+    Type type = Type::FILE;
+    std::string path;        // relative to the root, without "." nor ".."
+                             // segments (the members whose path climbs
+                             // out of the root are skipped)
+    std::string linkTarget;  // for SYMLINK members (as is) and HARDLINK
+                             // members (normalized like path)
+    uint64_t size = 0;       // size of the content of FILE members
+  };
+
+public: // functions
+  explicit TarReader(std::istream& in);
+
+  TarReader(const TarReader&) = delete;
+  TarReader& operator=(const TarReader&) = delete;
+
+  // Reads the header of the next member (skipping what is left of the
+  // content of the current one). Returns false at the end of the archive.
+  // Throws std::runtime_error if the archive is malformed or truncated.
+  bool next(Member& member);
+
+  // Reads up to size bytes of the content of the current member. Returns
+  // the number of bytes read (0 at the end of the content).
+  size_t read(char* buffer, size_t size);
+
+private: // functions
+  bool readBlock(char* block);
+  std::string readExtension(uint64_t size);
+  void skip(uint64_t size);
+
+private: // data
+  std::istream& in;
+  uint64_t remaining = 0;  // bytes of the content of the current member left
+  uint64_t padding = 0;    // bytes padding the content to a whole block
+};
+
+#endif  // OPENZIM_ZIMWRITERFS_TARREADER_H
@@ -27,104 +27,152 @@
 #include <iostream>
 #include <iomanip>
 #include <regex>
-#include <map>
+#include <algorithm>
+#include <iterator>
+#include <limits>
 
 #include <zlib.h>
 #include <magic.h>
 
-static const std::map<std::string, std::string> extMimeTypes = {
-    {"html",       "text/html"},
+#include "../concurrent_cache.h"
+
+namespace
+{
+
+struct ExtensionMimeType
+{
+  std::string_view extension;
+  std::string_view mimeType;
+};
+
+// Sorted by extension
+constexpr ExtensionMimeType extMimeTypes[] = {
+    {"collection", "font/collection"},
+    {"css",        "text/css"},
+    {"doc",        "application/msword"},
+    {"docx",       "application/vnd.openxmlformats-officedocument.wordprocessingml.document"},
+    {"eot",        "application/vnd.ms-fontobject"},
+    {"epub",       "application/epub+zip"},
+    {"gif",        "image/gif"},
     {"htm",        "text/html"},
-    {"png",        "image/png"},
-    {"tiff",       "image/tiff"},
-    {"tif",        "image/tiff"},
+    {"html",       "text/html"},
     {"jpeg",       "image/jpeg"},
     {"jpg",        "image/jpeg"},
-    {"gif",        "image/gif"},
-    {"svg",        "image/svg+xml"},
-    {"txt",        "text/plain"},
-    {"xml",        "text/xml"},
-    {"epub",       "application/epub+zip"},
-    {"pdf",        "application/pdf"},
-    {"ogg",        "audio/ogg"},
-    {"ogv",        "video/ogg"},
     {"js",         "application/javascript"},
     {"json",       "application/json"},
-    {"css",        "text/css"},
+    {"mp4",        "video/mp4"},
+    {"odp",        "application/vnd.oasis.opendocument.text"},
+    {"odt",        "application/vnd.oasis.opendocument.text"},
+    {"ogg",        "audio/ogg"},
+    {"ogv",        "video/ogg"},
     {"otf",        "font/otf"},
+    {"pdf",        "application/pdf"},
+    {"png",        "image/png"},
+    {"ppt",        "application/vnd.ms-powerpoint"},
     {"sfnt",       "font/sfnt"},
-    {"eot",        "application/vnd.ms-fontobject"},
+    {"svg",        "image/svg+xml"},
+    {"tif",        "image/tiff"},
+    {"tiff",       "image/tiff"},
     {"ttf",        "font/ttf"},
-    {"collection", "font/collection"},
-    {"woff",       "font/woff"},
-    {"woff2",      "font/woff2"},
+    {"txt",        "text/plain"},
     {"vtt",        "text/vtt"},
+    {"wasm",       "application/wasm"},
     {"webm",       "video/webm"},
     {"webp",       "image/webp"},
-    {"mp4",        "video/mp4"},
-    {"doc",        "application/msword"},
-    {"docx",       "application/vnd.openxmlformats-officedocument.wordprocessingml.document"},
-    {"ppt",        "application/vnd.ms-powerpoint"},
-    {"odt",        "application/vnd.oasis.opendocument.text"},
-    {"odp",        "application/vnd.oasis.opendocument.text"},
-    {"zip",        "application/zip"},
-    {"wasm",       "application/wasm"}
+    {"woff",       "font/woff"},
+    {"woff2",      "font/woff2"},
+    {"xml",        "text/xml"},
+    {"zip",        "application/zip"}
 };
 
-static std::map<std::string, std::string> fileMimeTypes;
+constexpr bool isSortedByExtension(const ExtensionMimeType* table, size_t size)
+{
+  for (size_t i = 1; i < size; ++i) {
+    if (!(table[i - 1].extension < table[i].extension))
+      return false;
+  }
+  return true;
+}
 
-extern bool inflateHtmlFlag;
+static_assert(isSortedByExtension(extMimeTypes, std::size(extMimeTypes)),
+              "extMimeTypes must be sorted by extension");
 
-extern magic_t magic;
+// Number of leading bytes of a file examined by libmagic
+const size_t MIMETYPE_SNIFF_SIZE = 8*1024;
 
-/* Decompress an STL string using zlib and return the original data. */
-inline std::string inflateString(const std::string& str)
+// libmagic handles can't be shared by threads, so every thread opens its own
+class MagicHandle
 {
-  z_stream zs;  // z_stream is zlib's control structure
-  memset(&zs, 0, sizeof(zs));
-
-  if (inflateInit(&zs) != Z_OK)
-    throw(std::runtime_error("inflateInit failed while decompressing."));
-
-  zs.next_in = (Bytef*)str.data();
-  zs.avail_in = str.size();
+public:
+  MagicHandle()
+    : handle(magic_open(MAGIC_MIME))
+  {
+    if (handle != nullptr && magic_load(handle, NULL) != 0) {
+      magic_close(handle);
+      handle = nullptr;
+    }
+  }
 
-  int ret;
-  char outbuffer[32768];
-  std::string outstring;
+  ~MagicHandle()
+  {
+    if (handle != nullptr)
+      magic_close(handle);
+  }
 
-  // get the decompressed bytes blockwise using repeated calls to inflate
-  do {
-    zs.next_out = reinterpret_cast<Bytef*>(outbuffer);
-    zs.avail_out = sizeof(outbuffer);
+  MagicHandle(const MagicHandle&) = delete;
+  MagicHandle& operator=(const MagicHandle&) = delete;
 
-    ret = inflate(&zs, 0);
+  // Returns the mimetype of data (or "" if libmagic can't tell)
+  std::string getMimeType(std::string_view data) const
+  {
+    const char* const result = handle != nullptr
+                             ? magic_buffer(handle, data.data(), data.size())
+                             : nullptr;
+    if (result == nullptr)
+      return "";
 
-    if (outstring.size() < zs.total_out) {
-      outstring.append(outbuffer, zs.total_out - outstring.size());
-    }
-  } while (ret == Z_OK);
+    const std::string_view mimeType(result);
+    return std::string(mimeType.substr(0, mimeType.find(';')));
+  }
 
-  inflateEnd(&zs);
+private:
+  magic_t handle;
+};
 
-  if (ret != Z_STREAM_END) {  // an error occurred that was not EOF
-    std::ostringstream oss;
-    oss << "Exception during zlib decompression: (" << ret << ") " << zs.msg;
-    throw(std::runtime_error(oss.str()));
+uint64_t fnv1aHash(std::string_view data)
+{
+  uint64_t h = 14695981039346656037ULL;
+  for (const char c : data) {
+    h = (h ^ static_cast<unsigned char>(c)) * 1099511628211ULL;
   }
-
-  return outstring;
+  return h;
 }
 
-std::string getMimeTypeFromExtension(const std::string& extension)
+// A mimetype detected by libmagic and the bytes it was detected from
+struct SniffedMimeType
 {
-  const auto it = extMimeTypes.find(asciitolower(extension));
-  return it != extMimeTypes.end() ?  it->second : "";
-}
+  std::string content;
+  std::string mimeType;
+};
+
+// Mimetypes detected by libmagic keyed by the hash of the examined bytes
+// (files generated from the same template usually start the same way).
+// The bytes are compared on a hit, so a collision only costs a detection.
+zim::ConcurrentCache<uint64_t, SniffedMimeType> sniffedMimeTypes(1024);
+
+} // unnamed namespace
 
-inline bool seemsToBeHtml(const std::string& path)
+std::string_view getMimeTypeFromExtension(std::string_view extension)
 {
-  return getMimeTypeFromExtension(getFileExtension(path)) == "text/html";
+  const std::string lowercaseExtension = asciitolower(std::string(extension));
+  const auto it = std::lower_bound(std::begin(extMimeTypes), std::end(extMimeTypes),
+                                   lowercaseExtension,
+                                   [](const ExtensionMimeType& entry, const std::string& ext) {
+                                     return entry.extension < ext;
+                                   });
+  return it != std::end(extMimeTypes) && it->extension == lowercaseExtension
+       ? it->mimeType
+       : std::string_view();
 }
 
 std::string getFileContent(const std::string& path)
@@ -136,23 +184,289 @@ std::string getFileContent(const std::string& path)
     in.seekg(0, std::ios::beg);
     in.read(&contents[0], contents.size());
     in.close();
+    return (contents);
+  }
+  std::cerr << "zimwriterfs: unable to open file at path: " << path
+            << std::endl;
+  throw(errno);
+}
+
+namespace
+{
+
+// Frees the zlib state on every exit path
+struct InflateStream : z_stream
+{
+  InflateStream() : z_stream()
+  {
+    // +32 enables the automatic detection of the zlib and gzip headers
+    if (inflateInit2(this, 15 + 32) != Z_OK)
+      throw std::runtime_error("inflateInit failed while decompressing.");
+  }
+  ~InflateStream() { inflateEnd(this); }
+
+  InflateStream(const InflateStream&) = delete;
+  InflateStream& operator=(const InflateStream&) = delete;
+};
+
+// Returns true if the first two bytes of a file are the header of gzip or
+// zlib compressed data (as detected by inflateInit2() with 15 + 32)
+bool isCompressedDataHeader(const unsigned char bytes[2])
+{
+  if (bytes[0] == 0x1f && bytes[1] == 0x8b)
+    return true; // gzip
+
+  // zlib: deflate with a window of at most 32 KiB, and a check value
+  return (bytes[0] & 0x0f) == 8 && (bytes[0] >> 4) <= 7
+      && (bytes[0] * 256 + bytes[1]) % 31 == 0;
+}
+
+// Returns the uncompressed size recorded in the footer of a gzip file (or 0
+// for another format). It is only a hint: the footer stores the size modulo
+// 2^32 and, for a file of several gzip members, the size of the last one.
+size_t getGzipSizeHint(std::ifstream& in, size_t fileSize)
+{
+  const size_t GZIP_HEADER_SIZE = 10, GZIP_FOOTER_SIZE = 8;
+  if (fileSize < GZIP_HEADER_SIZE + GZIP_FOOTER_SIZE)
+    return 0;
+
+  unsigned char bytes[4];
+  in.seekg(0);
+  in.read(reinterpret_cast<char*>(bytes), 2);
+  if (!in || bytes[0] != 0x1f || bytes[1] != 0x8b)
+    return 0;
+
+  in.seekg(fileSize - 4);
+  in.read(reinterpret_cast<char*>(bytes), 4);
+  if (!in)
+    return 0;
+
+  const size_t size = size_t(bytes[0])       | size_t(bytes[1]) << 8
+                    | size_t(bytes[2]) << 16 | size_t(bytes[3]) << 24;
+  // Deflate can't compress by more than ~1032:1, a bigger size is bogus
+  return std::min(size, fileSize * 1032);
+}
+
+} // unnamed namespace
+
+bool inflateFileContent(const std::string& path, std::string& content)
+{
+  std::ifstream in(path, std::ios::binary | std::ios::ate);
+  if (!in) {
+    throw std::runtime_error(Formatter() << "Unable to open " << path);
+  }
+  const size_t fileSize = in.tellg();
+
+  // Most files given to -x aren't compressed: they are left alone before
+  // any memory is allocated for their output
+  unsigned char header[2];
+  in.seekg(0);
+  in.read(reinterpret_cast<char*>(header), sizeof(header));
+  if (!in || !isCompressedDataHeader(header)) {
+    return false;
+  }
 
-    /* Inflate if necessary */
-    if (inflateHtmlFlag && seemsToBeHtml(path)) {
-      try {
-        contents = inflateString(contents);
-      } catch (...) {
-        std::cerr << "Can not initialize inflate stream for: " << path
-                  << std::endl;
+  const size_t sizeHint = getGzipSizeHint(in, fileSize);
+  in.clear();
+  in.seekg(0);
+
+  // One more byte than expected so that the end of the stream is reached
+  // without growing the output
+  std::string output(sizeHint > 0 ? sizeHint + 1 : std::max<size_t>(4 * fileSize, 4096), '\0');
+  size_t outputSize = 0;
+
+  InflateStream zs;
+  char inputBuffer[64*1024];
+  int ret = Z_OK;
+  while (ret != Z_STREAM_END) {
+    if (zs.avail_in == 0) {
+      in.read(inputBuffer, sizeof(inputBuffer));
+      zs.next_in = reinterpret_cast<Bytef*>(inputBuffer);
+      zs.avail_in = in.gcount();
+      if (zs.avail_in == 0) {
+        throw std::runtime_error(Formatter() << "Truncated compressed data in " << path);
       }
     }
-    return (contents);
+    if (outputSize == output.size()) {
+      output.resize(2 * output.size());
+    }
+    zs.next_out = reinterpret_cast<Bytef*>(&output[outputSize]);
+    zs.avail_out = std::min<size_t>(output.size() - outputSize,
+                                    std::numeric_limits<uInt>::max());
+
+    ret = inflate(&zs, Z_NO_FLUSH);
+    outputSize = reinterpret_cast<char*>(zs.next_out) - output.data();
+    if (ret != Z_OK && ret != Z_STREAM_END) {
+      throw std::runtime_error(Formatter() << "Exception during zlib decompression of "
+                                           << path << ": (" << ret << ") "
+                                           << (zs.msg ? zs.msg : ""));
+    }
+  }
+
+  output.resize(outputSize);
+  content = std::move(output);
+  return true;
+}
+
+namespace
+{
+
+// SHA-256 (FIPS 180-4), enough to identify identical contents
+class Sha256
+{
+public:
+  void update(const char* data, size_t size)
+  {
+    totalSize += size;
+    while (size > 0) {
+      const size_t count = std::min(size, sizeof(block) - blockSize);
+      memcpy(block + blockSize, data, count);
+      blockSize += count;
+      data += count;
+      size -= count;
+      if (blockSize == sizeof(block)) {
+        processBlock();
+        blockSize = 0;
+      }
+    }
+  }
+
+  // Returns the 32 bytes of the digest (the object can't be updated then)
+  std::string digest()
+  {
+    const uint64_t bitCount = totalSize * 8;
+    const char padding[64] = {'\x80'};
+    update(padding, 1 + (119 - blockSize) % 64);
+    char length[8];
+    for (int i = 0; i < 8; ++i) {
+      length[i] = char(bitCount >> (56 - 8 * i));
+    }
+    update(length, sizeof(length));
+
+    std::string result(32, '\0');
+    for (int i = 0; i < 32; ++i) {
+      result[i] = char(state[i / 4] >> (24 - 8 * (i % 4)));
+    }
+    return result;
+  }
+
+private:
+  static uint32_t rotr(uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+
+  void processBlock()
+  {
+    static const uint32_t k[64] = {
+      0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+      0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+      0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+      0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+      0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+      0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+      0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+      0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+    };
+
+    uint32_t w[64];
+    for (int i = 0; i < 16; ++i) {
+      w[i] = uint32_t(block[4 * i]) << 24 | uint32_t(block[4 * i + 1]) << 16
+           | uint32_t(block[4 * i + 2]) << 8 | uint32_t(block[4 * i + 3]);
+    }
+    for (int i = 16; i < 64; ++i) {
+      const uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+      const uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+      w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+    for (int i = 0; i < 64; ++i) {
+      const uint32_t t1 = h + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25))
+                        + ((e & f) ^ (~e & g)) + k[i] + w[i];
+      const uint32_t t2 = (rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22))
+                        + ((a & b) ^ (a & c) ^ (b & c));
+      h = g;
+      g = f;
+      f = e;
+      e = d + t1;
+      d = c;
+      c = b;
+      b = a;
+      a = t1 + t2;
+    }
+    state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+    state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+  }
+
+  uint32_t state[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+  };
+  unsigned char block[64];
+  size_t blockSize = 0;
+  uint64_t totalSize = 0;
+};
+
+} // unnamed namespace
+
+bool getFileDigest(const std::string& path, std::string& digest, uint64_t& size)
+{
+  std::ifstream in(path, std::ios::binary);
+  if (!in) {
+    return false;
+  }
+
+  char buffer[64*1024];
+  Sha256 sha256;
+  size = 0;
+  do {
+    in.read(buffer, sizeof(buffer));
+    sha256.update(buffer, in.gcount());
+    size += in.gcount();
+  } while (in);
+  if (!in.eof()) {
+    return false;
+  }
+  digest = sha256.digest();
+  return true;
+}
+
+std::string readFileStart(const std::string& path)
+{
+  std::ifstream in(path, std::ios::binary);
+  if (in) {
+    std::string contents(FILE_START_SIZE, '\0');
+    in.read(&contents[0], contents.size());
+    contents.resize(in.gcount());
+    return contents;
   }
   std::cerr << "zimwriterfs: unable to open file at path: " << path
             << std::endl;
   throw(errno);
 }
 
+std::string getHtmlFileHead(const std::string& path, std::string fileStart,
+                            HtmlHead& head, bool& headScanned)
+{
+  size_t headEnd;
+  headScanned = scanHtmlHead(fileStart, head, &headEnd);
+  if (fileStart.size() < FILE_START_SIZE) {
+    return fileStart; // the whole file
+  }
+  if (headScanned && headEnd < fileStart.size()) {
+    return fileStart;
+  }
+
+  // The head (or what stopped the scan) may go beyond the first bytes
+  std::string contents = getFileContent(path);
+  headScanned = scanHtmlHead(contents, head);
+  return contents;
+}
+
+std::string getHtmlFileHead(const std::string& path, HtmlHead& head, bool& headScanned)
+{
+  return getHtmlFileHead(path, readFileStart(path), head, headScanned);
+}
+
 std::string extractRedirectUrlFromHtmlHeadValue(const std::string& refresh_value)
 {
   std::string url;
@@ -168,14 +482,22 @@ std::string extractRedirectUrlFromHtmlHeadValue(const std::string& refresh_value
   return url;
 }
 
-std::string extractRedirectUrlFromHtml(const GumboVector* head_children)
+void readHtmlHead(const GumboVector* head_children, HtmlHead& head)
 {
-  std::string url;
-
   for (unsigned int i = 0; i < head_children->length; ++i) {
     GumboNode* child = (GumboNode*)(head_children->data[i]);
-    if (child->type == GUMBO_NODE_ELEMENT
-        && child->v.element.tag == GUMBO_TAG_META) {
+    if (child->type != GUMBO_NODE_ELEMENT)
+      continue;
+
+    if (child->v.element.tag == GUMBO_TAG_TITLE) {
+      if (child->v.element.children.length == 1) {
+        GumboNode* title_text
+            = (GumboNode*)(child->v.element.children.data[0]);
+        if (title_text->type == GUMBO_NODE_TEXT) {
+          head.title = title_text->v.text.text;
+        }
+      }
+    } else if (child->v.element.tag == GUMBO_TAG_META) {
       GumboAttribute* attribute;
       if ((attribute
            = gumbo_get_attribute(&child->v.element.attributes, "http-equiv"))
@@ -184,20 +506,389 @@ std::string extractRedirectUrlFromHtml(const GumboVector* head_children)
           if ((attribute
                = gumbo_get_attribute(&child->v.element.attributes, "content"))
               != NULL) {
-            url = extractRedirectUrlFromHtmlHeadValue(attribute->value);
-            if (url.empty()) {
-              throw std::runtime_error(
-                "Unable to find the redirect/refresh target URL in the HTML DOM");
-            }
+            head.refreshValues.push_back(attribute->value);
           }
         }
       }
     }
   }
+}
+
+std::string extractRedirectUrlFromHtmlHead(const HtmlHead& head)
+{
+  std::string url;
+
+  for (const auto& refreshValue : head.refreshValues) {
+    url = extractRedirectUrlFromHtmlHeadValue(refreshValue);
+    if (url.empty()) {
+      throw std::runtime_error(
+        "Unable to find the redirect/refresh target URL in the HTML DOM");
+    }
+  }
 
   return url;
 }
 
+std::string extractRedirectUrlFromHtml(const GumboVector* head_children)
+{
+  HtmlHead head;
+  readHtmlHead(head_children, head);
+  return extractRedirectUrlFromHtmlHead(head);
+}
+
+namespace
+{
+
+bool isHtmlWhitespace(char c)
+{
+  return c == ' ' || c == '\t' || c == '\n' || c == '\f' || c == '\r';
+}
+
+bool isAsciiAlpha(char c)
+{
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+bool equalsIgnoringAsciiCase(std::string_view s, std::string_view lowercaseStr)
+{
+  if (s.size() != lowercaseStr.size())
+    return false;
+  for (size_t i = 0; i < s.size(); ++i) {
+    if (char(tolower(static_cast<unsigned char>(s[i]))) != lowercaseStr[i])
+      return false;
+  }
+  return true;
+}
+
+// Converts the text of the document as the HTML parser does: newlines are
+// normalized and character references are decoded. Returns false if the
+// text isn't valid UTF-8 (Gumbo replaces the invalid sequences).
+bool decodeHtmlText(std::string_view raw, std::string& text, bool inAttributeValue)
+{
+  if (findInvalidUtf8(raw) != raw.size())
+    return false;
+
+  text.clear();
+  if (raw.find('\r') == std::string_view::npos) {
+    decodeHtmlEntities(raw, text, inAttributeValue);
+    return true;
+  }
+
+  std::string normalized;
+  for (size_t i = 0; i < raw.size(); ++i) {
+    if (raw[i] != '\r') {
+      normalized += raw[i];
+    } else if (i + 1 == raw.size() || raw[i + 1] != '\n') {
+      normalized += '\n';
+    }
+  }
+  decodeHtmlEntities(normalized, text, inAttributeValue);
+  return true;
+}
+
+// Tokenizes the beginning of an HTML document as described in
+// https://html.spec.whatwg.org/multipage/parsing.html, following the tree
+// construction rules only as far as the "in head" and "after head"
+// insertion modes. Every method returns false on something which is left
+// to a real parser.
+class HtmlHeadScanner
+{
+public: // functions
+  explicit HtmlHeadScanner(std::string_view html)
+    : p(html.data())
+    , end(html.data() + html.size())
+  {}
+
+  bool scan(HtmlHead& head);
+
+  const char* position() const { return p; }
+
+private: // types
+  struct Tag
+  {
+    std::string_view name;
+    bool isEndTag = false;
+
+    // Only filled for <meta> tags: the first value of these attributes
+    // (if present)
+    bool hasHttpEquiv = false, hasContent = false;
+    std::string_view httpEquiv, content;
+  };
+
+private: // functions
+  bool readTag(Tag& tag);
+  bool readAttributes(Tag& tag);
+  bool skipTill(std::string_view s);
+  bool skipTillEndTag(std::string_view lowercaseTagName, std::string_view* text = nullptr);
+
+  // Returns true if the text till the next '<' is whitespace
+  bool skipWhitespaceText();
+
+private: // data
+  const char* p;
+  const char* const end;
+};
+
+bool HtmlHeadScanner::skipTill(std::string_view s)
+{
+  const std::string_view rest(p, end - p);
+  const auto pos = rest.find(s);
+  p = pos == std::string_view::npos ? end : p + pos + s.size();
+  return true;
+}
+
+bool HtmlHeadScanner::skipWhitespaceText()
+{
+  while (p != end && *p != '<') {
+    if (!isHtmlWhitespace(*p))
+      return false;
+    ++p;
+  }
+  return true;
+}
+
+bool HtmlHeadScanner::readAttributes(Tag& tag)
+{
+  const bool isMeta = !tag.isEndTag && equalsIgnoringAsciiCase(tag.name, "meta");
+  while (true) {
+    while (p != end && isHtmlWhitespace(*p))
+      ++p;
+    if (p == end)
+      return false;
+    if (*p == '>') {
+      ++p;
+      return true;
+    }
+    if (*p == '/') {
+      ++p;
+      continue;
+    }
+
+    // The first character of an attribute name may be a '='
+    const char* const nameStart = p++;
+    while (p != end && !isHtmlWhitespace(*p) && *p != '/' && *p != '>' && *p != '=')
+      ++p;
+    const std::string_view name(nameStart, p - nameStart);
+    while (p != end && isHtmlWhitespace(*p))
+      ++p;
+    if (p == end)
+      return false;
+
+    std::string_view value;
+    if (*p == '=') {
+      ++p;
+      while (p != end && isHtmlWhitespace(*p))
+        ++p;
+      if (p == end)
+        return false;
+      if (*p == '"' || *p == '\'') {
+        const char* const valueEnd = static_cast<const char*>(memchr(p + 1, *p, end - p - 1));
+        if (valueEnd == nullptr)
+          return false;
+        value = std::string_view(p + 1, valueEnd - p - 1);
+        p = valueEnd + 1;
+      } else if (*p != '>') {
+        const char* const valueStart = p;
+        while (p != end && !isHtmlWhitespace(*p) && *p != '>')
+          ++p;
+        if (p == end)
+          return false;
+        value = std::string_view(valueStart, p - valueStart);
+      }
+    }
+
+    // Only the first of duplicate attributes is kept
+    if (isMeta) {
+      if (!tag.hasHttpEquiv && equalsIgnoringAsciiCase(name, "http-equiv")) {
+        tag.hasHttpEquiv = true;
+        tag.httpEquiv = value;
+      } else if (!tag.hasContent && equalsIgnoringAsciiCase(name, "content")) {
+        tag.hasContent = true;
+        tag.content = value;
+      }
+    }
+  }
+}
+
+// Reads a tag starting right after its '<' (or "</")
+bool HtmlHeadScanner::readTag(Tag& tag)
+{
+  const char* const nameStart = p;
+  while (p != end && !isHtmlWhitespace(*p) && *p != '/' && *p != '>')
+    ++p;
+  tag.name = std::string_view(nameStart, p - nameStart);
+  return readAttributes(tag);
+}
+
+// Skips the content of a RAWTEXT, RCDATA or script element and its end tag
+bool HtmlHeadScanner::skipTillEndTag(std::string_view lowercaseTagName, std::string_view* text)
+{
+  const char* const textStart = p;
+  for (;;) {
+    const char* const lt = static_cast<const char*>(memchr(p, '<', end - p));
+    if (lt == nullptr)
+      return false; // unterminated element
+
+    p = lt + 1;
+    if (p != end && *p == '/') {
+      const char* const name = p + 1;
+      const size_t nameLength = lowercaseTagName.size();
+      if (size_t(end - name) > nameLength
+          && equalsIgnoringAsciiCase(std::string_view(name, nameLength), lowercaseTagName)
+          && (isHtmlWhitespace(name[nameLength]) || name[nameLength] == '/' || name[nameLength] == '>')) {
+        if (text) {
+          *text = std::string_view(textStart, lt - textStart);
+        }
+        p = name;
+        Tag tag;
+        tag.isEndTag = true;
+        return readTag(tag);
+      }
+    } else if (lowercaseTagName == "script" && size_t(end - p) >= 3 && std::string_view(p, 3) == "!--") {
+      return false; // escaped script data
+    }
+  }
+}
+
+bool HtmlHeadScanner::scan(HtmlHead& head)
+{
+  std::string text;
+  while (true) {
+    if (!skipWhitespaceText())
+      return true; // the body starts with that text
+    if (p == end)
+      return true;
+
+    ++p; // '<'
+    if (p == end)
+      return true; // a '<' is text of the body
+
+    if (*p == '!') {
+      ++p;
+      if (size_t(end - p) >= 2 && p[0] == '-' && p[1] == '-') {
+        // A comment (possibly closed abruptly by "<!-->" or "<!--->")
+        p += 2;
+        if (p != end && *p == '>') {
+          ++p;
+        } else if (size_t(end - p) >= 2 && p[0] == '-' && p[1] == '>') {
+          p += 2;
+        } else {
+          const std::string_view rest(p, end - p);
+          const auto closing = std::min(rest.find("-->"), rest.find("--!>"));
+          if (closing == std::string_view::npos) {
+            p = end;
+            return true; // the comment extends to the end of the document
+          }
+          p += closing + (rest[closing + 2] == '!' ? 4 : 3);
+        }
+      } else {
+        skipTill(">"); // DOCTYPE or bogus comment
+      }
+      continue;
+    }
+
+    if (*p == '?') {
+      skipTill(">"); // bogus comment
+      continue;
+    }
+
+    Tag tag;
+    if (*p == '/') {
+      ++p;
+      if (p == end)
+        return true; // "</" is text of the body
+      if (*p == '>') {
+        ++p;
+        continue;
+      }
+      if (!isAsciiAlpha(*p)) {
+        skipTill(">"); // bogus comment
+        continue;
+      }
+
+      tag.isEndTag = true;
+      if (!readTag(tag))
+        return false;
+
+      if (equalsIgnoringAsciiCase(tag.name, "body")
+          || equalsIgnoringAsciiCase(tag.name, "html")
+          || equalsIgnoringAsciiCase(tag.name, "br"))
+        return true;
+
+      // Other end tags (including </head>) don't end the head: elements
+      // like <title> or <meta> found after it are still put into the head.
+      continue;
+    }
+
+    if (!isAsciiAlpha(*p))
+      return true; // a '<' is text of the body
+
+    if (!readTag(tag))
+      return false;
+
+    if (equalsIgnoringAsciiCase(tag.name, "title")) {
+      std::string_view rawTitle;
+      if (!skipTillEndTag("title", &rawTitle) || !decodeHtmlText(rawTitle, text, false))
+        return false;
+
+      // Gumbo ignores the titles which are empty or made only of whitespace
+      if (!std::all_of(text.begin(), text.end(), isHtmlWhitespace)) {
+        head.title = text;
+      }
+    } else if (equalsIgnoringAsciiCase(tag.name, "meta")) {
+      if (tag.hasHttpEquiv && tag.hasContent) {
+        if (!decodeHtmlText(tag.httpEquiv, text, true))
+          return false;
+        if (text == "refresh") {
+          if (!decodeHtmlText(tag.content, text, true))
+            return false;
+          head.refreshValues.push_back(text);
+        }
+      }
+    } else if (equalsIgnoringAsciiCase(tag.name, "script")) {
+      if (!skipTillEndTag("script"))
+        return false;
+    } else if (equalsIgnoringAsciiCase(tag.name, "style")
+               || equalsIgnoringAsciiCase(tag.name, "noframes")) {
+      if (!skipTillEndTag(equalsIgnoringAsciiCase(tag.name, "style") ? "style" : "noframes"))
+        return false;
+    } else if (equalsIgnoringAsciiCase(tag.name, "noscript")
+               || equalsIgnoringAsciiCase(tag.name, "template")) {
+      return false;
+    } else if (!equalsIgnoringAsciiCase(tag.name, "html")
+               && !equalsIgnoringAsciiCase(tag.name, "head")
+               && !equalsIgnoringAsciiCase(tag.name, "link")
+               && !equalsIgnoringAsciiCase(tag.name, "base")
+               && !equalsIgnoringAsciiCase(tag.name, "basefont")
+               && !equalsIgnoringAsciiCase(tag.name, "bgsound")) {
+      return true; // any other element starts the body
+    }
+  }
+}
+
+} // unnamed namespace
+
+bool scanHtmlHead(std::string_view html, HtmlHead& head, size_t* headEnd)
+{
+  // Like gumbo_parse(html.c_str()), ignore everything after a NUL character
+  html = html.substr(0, html.find('\0'));
+
+  // Leave the handling of a byte order mark to Gumbo
+  if (html.substr(0, 3) == "\xEF\xBB\xBF")
+    return false;
+
+  HtmlHead scannedHead;
+  HtmlHeadScanner scanner(html);
+  if (!scanner.scan(scannedHead))
+    return false;
+
+  head = std::move(scannedHead);
+  if (headEnd) {
+    *headEnd = scanner.position() - html.data();
+  }
+  return true;
+}
+
 std::string generateDate()
 {
   time_t t = time(0);
@@ -210,31 +901,16 @@ std::string generateDate()
 }
 
 
-std::string getMimeTypeForFile(const std::string &directoryPath, const std::string& filename)
+std::string getMimeTypeFromContent(std::string_view content)
 {
-  /* Try to get the mimeType from the file extension */
-  std::string mimeType = getMimeTypeFromExtension(getFileExtension(filename));
-  if ( !mimeType.empty() ) {
-    return mimeType;
-  }
-
-  /* Try to get the mimeType from the cache */
-  try {
-    return fileMimeTypes.at(filename);
-  } catch (std::out_of_range&) {}
-
-  /* Try to get the mimeType with libmagic */
-  try {
-    std::string path = directoryPath + "/" + filename;
-    mimeType = std::string(magic_file(magic, path.c_str()));
-    if (mimeType.find(";") != std::string::npos) {
-      mimeType = mimeType.substr(0, mimeType.find(";"));
-    }
-    fileMimeTypes[filename] = mimeType;
-  } catch (...) { }
-  if (mimeType.empty()) {
-    return "application/octet-stream";
-  } else {
-    return mimeType;
-  }
+  content = content.substr(0, MIMETYPE_SNIFF_SIZE);
+  thread_local const MagicHandle magicHandle;
+  const uint64_t key = fnv1aHash(content) ^ content.size();
+  const SniffedMimeType sniffed = sniffedMimeTypes.getOrPut(key, [content]() {
+    return SniffedMimeType{std::string(content), magicHandle.getMimeType(content)};
+  });
+  const std::string mimeType = sniffed.content == content
+                             ? sniffed.mimeType
+                             : magicHandle.getMimeType(content);
+  return mimeType.empty() ? "application/octet-stream" : mimeType;
 }
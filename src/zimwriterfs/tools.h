@@ -22,15 +22,72 @@
 #define OPENZIM_ZIMWRITERFS_TOOLS_H
 
 #include <gumbo.h>
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <vector>
 
 std::string getFileContent(const std::string& path);
 
+// Reads and decompresses a zlib or gzip compressed file into content. The
+// file is read by blocks and the output is sized from the gzip footer (if
+// any). Returns false if the file doesn't start like compressed data.
+// Throws std::runtime_error if the file can't be read or decompressed.
+bool inflateFileContent(const std::string& path, std::string& content);
+
+// Computes the SHA-256 digest (32 bytes) and the size of the content of
+// the file at path. Returns false if the file can't be read.
+bool getFileDigest(const std::string& path, std::string& digest, uint64_t& size);
+
+// What zimwriterfs needs from the <head> of an HTML page
+struct HtmlHead
+{
+  std::string title;  // text of the last non-blank <title>
+  std::vector<std::string> refreshValues;  // of the <meta http-equiv="refresh">
+};
+
+// Size of the beginning of a file read by readFileStart(): enough to
+// detect its mimetype and to hold the head of most HTML pages
+const size_t FILE_START_SIZE = 64*1024;
+
+// Reads the first FILE_START_SIZE bytes of a file (the whole file if it is
+// smaller)
+std::string readFileStart(const std::string& path);
+
+// Reads the beginning of an HTML file: its first 64 KiB if they contain
+// the whole head (according to scanHtmlHead()), the whole file otherwise.
+// headScanned tells if head was set by scanHtmlHead() from the returned
+// content (false if the page needs a full HTML parser).
+std::string getHtmlFileHead(const std::string& path, HtmlHead& head, bool& headScanned);
+
+// Same as above from the beginning of the file already read by
+// readFileStart()
+std::string getHtmlFileHead(const std::string& path, std::string fileStart,
+                            HtmlHead& head, bool& headScanned);
+
+// Scans the beginning of an HTML document for its title and refresh
+// redirections without building its DOM: the scan stops where the body
+// starts. Returns false (leaving head untouched) if the document contains
+// constructs that require a full HTML parser (like Gumbo). Otherwise the
+// offset where the scan stopped is stored in headEnd (if not null): the
+// result is final only if it is before the end of html.
+bool scanHtmlHead(std::string_view html, HtmlHead& head, size_t* headEnd = nullptr);
+
+// Same as scanHtmlHead() from a Gumbo DOM
+void readHtmlHead(const GumboVector* head_children, HtmlHead& head);
+
 std::string extractRedirectUrlFromHtmlHeadValue(const std::string& refresh_value);
+std::string extractRedirectUrlFromHtmlHead(const HtmlHead& head);
 std::string extractRedirectUrlFromHtml(const GumboVector* head_children);
 
 std::string generateDate();
 
-std::string getMimeTypeForFile(const std::string& basedir, const std::string& filename);
+// Returns the mimetype corresponding to a file extension (or "" if unknown)
+std::string_view getMimeTypeFromExtension(std::string_view extension);
+
+// Detects the mimetype of a file from its first bytes (only the first 8 KiB
+// are examined) with libmagic. Can be called from any thread; the results
+// are cached by content.
+std::string getMimeTypeFromContent(std::string_view content);
 
 #endif  // OPENZIM_ZIMWRITERFS_TOOLS_H
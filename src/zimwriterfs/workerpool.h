@@ -0,0 +1,66 @@
+#ifndef OPENZIM_ZIMWRITERFS_WORKERPOOL_H
+#define OPENZIM_ZIMWRITERFS_WORKERPOOL_H
+
+#include <algorithm>
+#include <functional>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "queue.h"
+
+/**
+ * A fixed set of threads running the tasks submitted to the pool.
+ *
+ * submit() returns a future of the result of the task (or of the exception
+ * that it threw). It blocks while queueCapacity tasks are already waiting.
+ */
+class WorkerPool
+{
+public: // functions
+  WorkerPool(unsigned threadCount, size_t queueCapacity)
+    : tasks(queueCapacity)
+  {
+    for (unsigned i = 0; i < std::max(threadCount, 1u); ++i) {
+      threads.emplace_back([this]() { this->run(); });
+    }
+  }
+
+  // Waits for the submitted tasks to complete
+  ~WorkerPool()
+  {
+    tasks.close();
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+
+  template<class F>
+  auto submit(F f) -> std::future<decltype(f())>
+  {
+    // std::function must be copyable, std::packaged_task isn't
+    const auto task = std::make_shared<std::packaged_task<decltype(f())()>>(std::move(f));
+    auto future = task->get_future();
+    tasks.push([task]() { (*task)(); });
+    return future;
+  }
+
+private: // functions
+  void run()
+  {
+    std::function<void()> task;
+    while ( tasks.pop(task) ) {
+      task();
+    }
+  }
+
+private: // data
+  BoundedQueue<std::function<void()>> tasks;
+  std::vector<std::thread> threads;
+};
+
+#endif  // OPENZIM_ZIMWRITERFS_WORKERPOOL_H
@@ -21,42 +21,280 @@
 #include "zimcreatorfs.h"
 #include "../tools.h"
 #include "tools.h"
+#include "dircrawler.h"
+#include "workerpool.h"
 
 #include <fstream>
-#include <dirent.h>
+#include <iterator>
+#include <sys/mman.h>
 #include <sys/stat.h>
-#include <regex>
+#include <fcntl.h>
 #include <unistd.h>
 #include <limits.h>
 #include <cassert>
+#include <cstring>
 
-void parse_redirectArticles(std::istream& in_stream, redirect_handler handler) {
-  std::string line;
-  int line_number = 1;
-  while (std::getline(in_stream, line)) {
-    std::regex line_regex("^([^\\t]+)\\t([^\\t]+)\\t([^\\t]+)$");
-    std::smatch matches;
-    if (!std::regex_search(line, matches, line_regex) || matches.size() != 4) {
+namespace
+{
+
+// Size of the parts of a redirects file validated by the workers
+const size_t REDIRECT_CHUNK_SIZE = 4*1024*1024;
+
+// The redirects parsed from a part of a redirects file
+struct RedirectChunk
+{
+  std::vector<Redirect> redirects;  // up to the first invalid line
+  bool valid = true;
+  std::string invalidLine;
+};
+
+// Splits a line into its three non-empty tab separated fields
+bool parseRedirectLine(std::string_view line, Redirect& redirect)
+{
+  const char* const begin = line.data();
+  const char* const end = begin + line.size();
+  const char* const tab1 = static_cast<const char*>(memchr(begin, '\t', line.size()));
+  if (tab1 == nullptr || tab1 == begin)
+    return false;
+
+  const char* const tab2 = static_cast<const char*>(memchr(tab1 + 1, '\t', end - tab1 - 1));
+  if (tab2 == nullptr || tab2 == tab1 + 1 || tab2 + 1 == end
+      || memchr(tab2 + 1, '\t', end - tab2 - 1) != nullptr)
+    return false;
+
+  redirect.path.assign(begin, tab1);
+  redirect.title.assign(tab1 + 1, tab2);
+  redirect.target.assign(tab2 + 1, end);
+  return true;
+}
+
+RedirectChunk parseRedirectChunk(std::string_view data)
+{
+  RedirectChunk chunk;
+  while (!data.empty()) {
+    const char* const newline = static_cast<const char*>(memchr(data.data(), '\n', data.size()));
+    const size_t lineSize = newline ? newline - data.data() : data.size();
+    const std::string_view line = data.substr(0, lineSize);
+    Redirect redirect;
+    if (!parseRedirectLine(line, redirect)) {
+      chunk.valid = false;
+      chunk.invalidLine = std::string(line);
+      break;
+    }
+    chunk.redirects.push_back(std::move(redirect));
+    data.remove_prefix(std::min(lineSize + 1, data.size()));
+  }
+  return chunk;
+}
+
+// A file mapped in memory (read-only)
+class MappedFile
+{
+public:
+  explicit MappedFile(const std::string& path)
+  {
+    const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) {
+      const int err = errno;
+      if (fd >= 0)
+        close(fd);
+      throw std::runtime_error(Formatter() << "Unable to open " << path << ": " << strerror(err));
+    }
+
+    size = st.st_size;
+    if (size > 0) {
+      addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    const int err = errno;
+    close(fd);
+    if (addr == MAP_FAILED) {
+      throw std::runtime_error(Formatter() << "Unable to map " << path << ": " << strerror(err));
+    }
+    if (size > 0) {
+      madvise(addr, size, MADV_SEQUENTIAL);
+    }
+  }
+
+  ~MappedFile()
+  {
+    if (size > 0)
+      munmap(addr, size);
+  }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  std::string_view data() const
+  {
+    return size > 0 ? std::string_view(static_cast<const char*>(addr), size) : std::string_view();
+  }
+
+private:
+  void* addr = nullptr;
+  size_t size = 0;
+};
+
+// Files of a tar archive bigger than that are spooled to temporary files
+// rather than kept in memory until libzim compresses them
+const uint64_t TAR_MEMBER_MAX_MEMORY_SIZE = 4*1024*1024;
+
+// The part of a spooled file kept in memory to detect its mimetype
+const size_t TAR_MEMBER_HEAD_SIZE = 64*1024;
+
+// Resolves the target of a link of a tar archive (relative to the directory
+// of the link for a symlink, to the root of the archive for a hard link).
+// Returns false if it is outside of the archive.
+bool resolveTarLinkTarget(const TarReader::Member& link, std::string& target)
+{
+  const std::string& linkTarget = link.linkTarget;
+  std::string resolved;
+  if (link.type == TarReader::Member::Type::SYMLINK) {
+    if (!linkTarget.empty() && linkTarget[0] == '/')
+      return false;
+
+    const auto slash = link.path.rfind('/');
+    resolved = slash == std::string::npos ? "" : link.path.substr(0, slash);
+  }
+
+  for (size_t start = 0; start <= linkTarget.size(); ) {
+    const size_t end = std::min(linkTarget.find('/', start), linkTarget.size());
+    const std::string segment = linkTarget.substr(start, end - start);
+    if (segment == "..") {
+      if (resolved.empty())
+        return false;
+      const auto slash = resolved.rfind('/');
+      resolved.resize(slash == std::string::npos ? 0 : slash);
+    } else if (!segment.empty() && segment != ".") {
+      resolved += resolved.empty() ? segment : "/" + segment;
+    }
+    start = end + 1;
+  }
+  target = resolved;
+  return true;
+}
+
+// Validates chunks of a redirects file (ending at line boundaries) in the
+// workers and passes their redirects to the handler in order
+class RedirectChunkParser
+{
+public:
+  RedirectChunkParser(redirect_handler handler, unsigned threadCount)
+    : handler(handler),
+      maxPendingChunks(2 * std::max(threadCount, 1u)),
+      workers(threadCount, maxPendingChunks)
+  {}
+
+  // chunk must be a std::string_view valid until the end of the parsing,
+  // or a std::string
+  template<class Chunk>
+  void submit(Chunk chunk)
+  {
+    pendingChunks.push_back(workers.submit([chunk = std::move(chunk)]() {
+      return parseRedirectChunk(chunk);
+    }));
+    if (pendingChunks.size() >= maxPendingChunks) {
+      handleChunk();
+    }
+  }
+
+  void finish()
+  {
+    while (!pendingChunks.empty()) {
+      handleChunk();
+    }
+  }
+
+private:
+  void handleChunk()
+  {
+    RedirectChunk chunk = pendingChunks.front().get();
+    pendingChunks.pop_front();
+    for (auto& redirect : chunk.redirects) {
+      handler(std::move(redirect));
+      ++line_number;
+    }
+    if (!chunk.valid) {
       throw std::runtime_error(
-        Formatter() << "Invalid line #" << line_number << " : '" << line << "'"
+        Formatter() << "Invalid line #" << line_number << " : '" << chunk.invalidLine << "'"
       );
     }
+  }
+
+  redirect_handler handler;
+  const size_t maxPendingChunks;
+  WorkerPool workers;
+  std::deque<std::future<RedirectChunk>> pendingChunks;
+  int line_number = 1;
+};
 
-    Redirect redirect = {
-      .path= matches[1].str(),
-      .title = matches[2].str(),
-      .target = matches[3].str()
-    };
-    handler(redirect);
-    ++line_number;
+// Adds the directories containing path (relative to the root) to directories
+void addParentDirectories(const std::string& path, std::unordered_set<std::string>& directories)
+{
+  for (auto slash = path.rfind('/'); slash != std::string::npos && slash > 0;
+       slash = path.rfind('/', slash - 1)) {
+    if (!directories.insert(path.substr(0, slash)).second)
+      break;
   }
 }
 
+} // unnamed namespace
+
+void parse_redirectArticles(std::string_view data, redirect_handler handler, unsigned threadCount)
+{
+  RedirectChunkParser parser(handler, threadCount);
+  while (!data.empty()) {
+    size_t chunkSize = std::min(REDIRECT_CHUNK_SIZE, data.size());
+    if (chunkSize < data.size()) {
+      const void* const newline = memchr(data.data() + chunkSize, '\n', data.size() - chunkSize);
+      chunkSize = newline ? static_cast<const char*>(newline) - data.data() + 1 : data.size();
+    }
+    parser.submit(data.substr(0, chunkSize));
+    data.remove_prefix(chunkSize);
+  }
+  parser.finish();
+}
+
+void parse_redirectArticles(std::istream& in_stream, redirect_handler handler, unsigned threadCount)
+{
+  // The stream is read by blocks. The partial last line of a block is
+  // carried over to the next one.
+  RedirectChunkParser parser(handler, threadCount);
+  std::string partialLine;
+  while (in_stream) {
+    std::string chunk;
+    chunk.swap(partialLine);
+    const size_t carried = chunk.size();
+    chunk.resize(carried + REDIRECT_CHUNK_SIZE);
+    in_stream.read(&chunk[carried], REDIRECT_CHUNK_SIZE);
+    chunk.resize(carried + in_stream.gcount());
+
+    if (in_stream) {
+      const auto lastNewline = chunk.rfind('\n');
+      if (lastNewline == std::string::npos) {
+        partialLine.swap(chunk);
+        continue;
+      }
+      partialLine.assign(chunk, lastNewline + 1, std::string::npos);
+      chunk.resize(lastNewline + 1);
+    }
+    if (!chunk.empty()) {
+      parser.submit(std::move(chunk));
+    }
+  }
+  parser.finish();
+}
+
 bool isVerbose();
+extern bool inflateHtmlFlag;
 
 ZimCreatorFS::ZimCreatorFS(std::string _directoryPath)
   : directoryPath(_directoryPath)
 {
+  if (directoryPath.empty()) {
+    return;
+  }
+
   char buf[PATH_MAX];
 
   if (realpath(directoryPath.c_str(), buf) != buf) {
@@ -68,133 +306,429 @@ ZimCreatorFS::ZimCreatorFS(std::string _directoryPath)
   canonical_basedir = buf;
 }
 
+ZimCreatorFS::~ZimCreatorFS()
+{
+  for (const auto& path : spooledFiles) {
+    unlink(path.c_str());
+  }
+  if (!spoolDirectory.empty()) {
+    rmdir(spoolDirectory.c_str());
+  }
+}
+
 void ZimCreatorFS::add_redirectArticles_from_file(const std::string& path)
 {
-  std::ifstream in_stream;
+  const auto handler = [this](Redirect redirect) {
+    this->addCheckedRedirection(
+      redirect,
+      {{zim::writer::HintKeys::FRONT_ARTICLE, 1}},
+      false
+    );
+  };
 
-  in_stream.open(path.c_str());
   try {
-    parse_redirectArticles(in_stream,
-      [this](Redirect redirect) {
-        this->addRedirection(
-          redirect.path,
-          redirect.title,
-          redirect.target,
-          {{zim::writer::HintKeys::FRONT_ARTICLE, 1}}
-        );
+    // Pipes (like `-r <(command)` or /dev/stdin) can't be mapped
+    struct stat st;
+    if (stat(path.c_str(), &st) == 0 && !S_ISREG(st.st_mode)) {
+      std::ifstream in(path, std::ios::binary);
+      if (!in) {
+        throw std::runtime_error(Formatter() << "Unable to open " << path << ": " << strerror(errno));
       }
-    );
+      parse_redirectArticles(in, handler, htmlWorkerCount);
+    } else {
+      const MappedFile file(path);
+      parse_redirectArticles(file.data(), handler, htmlWorkerCount);
+    }
   } catch(const std::runtime_error& e) {
     std::cerr << e.what() << "\nin redirect file " << path << std::endl;
-    in_stream.close();
     exit(1);
   }
-  in_stream.close();
 }
 
 void ZimCreatorFS::visitDirectory(const std::string& path)
 {
-  if (isVerbose())
-    std::cout << "Visiting directory " << path << std::endl;
-
-  DIR* directory;
-
-  /* Open directory */
-  directory = opendir(path.c_str());
-  if (directory == NULL) {
-    std::cerr << "zimwriterfs: unable to open directory " << path << std::endl;
-    exit(1);
-  }
-
-  /* Read directory content */
-  struct dirent* entry;
-  while ((entry = readdir(directory)) != NULL) {
-    std::string entryName = entry->d_name;
-
-    /* Ignore this system navigation virtual directories */
-    if (entryName == "." || entryName == "..")
-      continue;
-
-    std::string fullEntryName = path + '/' + entryName;
-
-    switch (entry->d_type) {
-      case DT_REG:
-        addFile(fullEntryName);
-        break;
-      case DT_LNK:
-        processSymlink(path, fullEntryName);
+  // Bounds the number of files read ahead of their addition to the archive
+  const size_t maxPendingFiles = 16 * std::max(htmlWorkerCount, 1u);
+
+  WorkerPool htmlWorkers(htmlWorkerCount, maxPendingFiles);
+  PendingFiles pendingFiles;
+  DirectoryCrawler crawler(path, crawlerThreadCount);
+  DirectoryCrawler::Entry entry;
+  while (crawler.next(entry)) {
+    const std::string fullEntryName = entry.path.empty() ? path : path + '/' + entry.path;
+
+    switch (entry.type) {
+      case DirectoryCrawler::Entry::Type::DIRECTORY:
+        if (isVerbose())
+          std::cout << "Visiting directory " << fullEntryName << std::endl;
         break;
-      case DT_DIR:
-        visitDirectory(fullEntryName);
+      case DirectoryCrawler::Entry::Type::FILE:
+      {
+        // The files that must be parsed, sniffed by libmagic or hashed are
+        // handed to the workers
+        const auto mimetype = std::string(getMimeTypeFromExtension(getFileExtension(entry.path)));
+        if ( deduplicate || mimetype.empty() || mimetype.find("text/html") != std::string::npos ) {
+          pendingFiles.push_back(htmlWorkers.submit([this, fullEntryName, mimetype]() {
+            return analyzeFile(fullEntryName, mimetype);
+          }));
+        } else {
+          std::promise<AnalyzedFile> analyzedFile;
+          analyzedFile.set_value(analyzeFile(fullEntryName, mimetype));
+          pendingFiles.push_back(analyzedFile.get_future());
+        }
+        addPendingFiles(pendingFiles, maxPendingFiles);
         break;
-      case DT_BLK:
-        std::cerr << "Unable to deal with " << fullEntryName
-                  << " (this is a block device)" << std::endl;
+      }
+      case DirectoryCrawler::Entry::Type::SYMLINK:
+        processSymlink(fullEntryName.substr(0, fullEntryName.rfind('/')), fullEntryName);
         break;
-      case DT_CHR:
+      case DirectoryCrawler::Entry::Type::UNSUPPORTED:
         std::cerr << "Unable to deal with " << fullEntryName
-                  << " (this is a character device)" << std::endl;
+                  << " (" << entry.message << ")" << std::endl;
         break;
-      case DT_FIFO:
-        std::cerr << "Unable to deal with " << fullEntryName
-                  << " (this is a named pipe)" << std::endl;
+      case DirectoryCrawler::Entry::Type::STAT_ERROR:
+        std::cerr << "Unable to stat " << fullEntryName
+                  << ": " << entry.message << std::endl;
         break;
-      case DT_SOCK:
-        std::cerr << "Unable to deal with " << fullEntryName
-                  << " (this is a UNIX domain socket)" << std::endl;
+      case DirectoryCrawler::Entry::Type::DIRECTORY_ERROR:
+        std::cerr << "zimwriterfs: unable to open directory " << fullEntryName
+                  << ": " << entry.message << std::endl;
+        crawler.stop();
+        exit(1);
+    }
+  }
+  addPendingFiles(pendingFiles, 0);
+
+  if (deduplicate && isVerbose()) {
+    std::cout << duplicateCount << " duplicate files added as aliases" << std::endl;
+  }
+  if (inflateFailureCount > 0) {
+    std::cerr << "zimwriterfs: " << inflateFailureCount
+              << " file(s) could not be inflated and were added as they are"
+              << std::endl;
+  }
+}
+
+void ZimCreatorFS::visitTar(std::istream& in)
+{
+  const size_t maxPendingFiles = 16 * std::max(htmlWorkerCount, 1u);
+
+  WorkerPool htmlWorkers(htmlWorkerCount, maxPendingFiles);
+  PendingFiles pendingFiles;
+  // The links are added at the end: their targets may come after them
+  std::map<std::string, TarReader::Member> links;
+  std::unordered_set<std::string> directories;
+  TarReader tar(in);
+  TarReader::Member member;
+  while (tar.next(member)) {
+    // The directories aren't always listed as members
+    addParentDirectories(member.path, directories);
+    switch (member.type) {
+      case TarReader::Member::Type::DIRECTORY:
+        if (isVerbose())
+          std::cout << "Visiting directory " << member.path << std::endl;
+        directories.insert(member.path);
         break;
-      case DT_UNKNOWN:
-        struct stat s;
-        if (stat(fullEntryName.c_str(), &s) == 0) {
-          if (S_ISREG(s.st_mode)) {
-            addFile(fullEntryName);
-          } else if (S_ISDIR(s.st_mode)) {
-            visitDirectory(fullEntryName);
-          } else {
-            std::cerr << "Unable to deal with " << fullEntryName
-                      << " (no clue what kind of file it is - from stat())"
-                      << std::endl;
-          }
+      case TarReader::Member::Type::FILE:
+      {
+        std::string content(std::min<uint64_t>(member.size, TAR_MEMBER_MAX_MEMORY_SIZE), '\0');
+        std::string spoolPath;
+        if (member.size > TAR_MEMBER_MAX_MEMORY_SIZE) {
+          content.resize(TAR_MEMBER_HEAD_SIZE);
+          tar.read(&content[0], content.size());
+          spoolPath = spoolTarMember(tar, content);
+        } else {
+          tar.read(&content[0], content.size());
+        }
+
+        const auto mimetype = std::string(getMimeTypeFromExtension(getFileExtension(member.path)));
+        if ( mimetype.empty() || mimetype.find("text/html") != std::string::npos ) {
+          pendingFiles.push_back(htmlWorkers.submit(
+            [this, url = member.path, content = std::move(content), mimetype, spoolPath]() mutable {
+              return analyzeTarMember(url, std::move(content), mimetype, spoolPath);
+            }));
         } else {
-          std::cerr << "Unable to stat " << fullEntryName << std::endl;
+          std::promise<AnalyzedFile> analyzedFile;
+          analyzedFile.set_value(analyzeTarMember(member.path, std::move(content), mimetype, spoolPath));
+          pendingFiles.push_back(analyzedFile.get_future());
         }
+        addPendingFiles(pendingFiles, maxPendingFiles);
         break;
-      default:
-        std::cerr << "Unable to deal with " << fullEntryName
-                  << " (no clue what kind of file it is)" << std::endl;
+      }
+      case TarReader::Member::Type::SYMLINK:
+      case TarReader::Member::Type::HARDLINK:
+        links[member.path] = member;
         break;
+      case TarReader::Member::Type::OTHER:
+        std::cerr << "Unable to deal with " << member.path
+                  << " (unsupported type of tar member)" << std::endl;
+        break;
+    }
+  }
+  addPendingFiles(pendingFiles, 0);
+
+  for (const auto& link : links) {
+    addTarLink(link.second, links, directories);
+  }
+}
+
+std::string ZimCreatorFS::spoolTarMember(TarReader& tar, const std::string& head)
+{
+  if (spoolDirectory.empty()) {
+    const char* const tmpdir = getenv("TMPDIR");
+    std::string dirTemplate = std::string(tmpdir && *tmpdir ? tmpdir : "/tmp") + "/zimwriterfs-XXXXXX";
+    if (mkdtemp(&dirTemplate[0]) == nullptr) {
+      throw std::runtime_error(Formatter() << "Unable to create a temporary directory: "
+                                           << strerror(errno));
     }
+    spoolDirectory = dirTemplate;
   }
 
-  closedir(directory);
+  const std::string path = spoolDirectory + "/" + std::to_string(spooledFiles.size());
+  spooledFiles.push_back(path);
+  std::ofstream out(path, std::ios::binary);
+  out.write(head.data(), head.size());
+  char buffer[64*1024];
+  while (const size_t count = tar.read(buffer, sizeof(buffer))) {
+    out.write(buffer, count);
+  }
+  if (!out.flush()) {
+    throw std::runtime_error(Formatter() << "Unable to write the temporary file " << path);
+  }
+  return path;
+}
+
+ZimCreatorFS::AnalyzedFile ZimCreatorFS::analyzeTarMember(const std::string& url, std::string content,
+                                                          std::string mimetype, const std::string& spoolPath) const
+{
+  auto title = std::string{};
+  AnalyzedFile file;
+
+  if ( mimetype.empty() ) {
+    mimetype = getMimeTypeFromContent(content);
+  }
+
+  if ( mimetype.find("text/html") != std::string::npos ) {
+    HtmlHead head;
+    bool headScanned = false;
+    if (!spoolPath.empty()) {
+      content = getHtmlFileHead(spoolPath, head, headScanned);
+    }
+
+    file.hints[zim::writer::FRONT_ARTICLE] = 1;
+    auto redirectUrl = parseAndAdaptHtml(content, title, url, headScanned ? &head : nullptr);
+    if (!redirectUrl.empty()) {
+      // This is a redirect.
+      file.redirect = Redirect{url, title, redirectUrl};
+      return file;
+    }
+  }
+
+  if (spoolPath.empty()) {
+    file.item = zim::writer::StringItem::create(url, mimetype, title, file.hints, content);
+  } else {
+    file.item = std::make_shared<zim::writer::FileItem>(url, mimetype, title, file.hints, spoolPath);
+  }
+  return file;
+}
+
+void ZimCreatorFS::addTarLink(const TarReader::Member& link,
+                              const std::map<std::string, TarReader::Member>& links,
+                              const std::unordered_set<std::string>& directories)
+{
+  // Same limit as Linux
+  const int MAX_LINK_DEPTH = 40;
+
+  const char* const kind = link.type == TarReader::Member::Type::SYMLINK ? "symlink" : "hard link";
+  std::string target;
+  const TarReader::Member* current = &link;
+  for (int depth = 0; ; ++depth) {
+    if (depth == MAX_LINK_DEPTH) {
+      std::cerr << "Unable to resolve " << kind << " " << link.path
+                << ": Too many levels of symbolic links" << std::endl;
+      return;
+    }
+    if (!resolveTarLinkTarget(*current, target)) {
+      std::cerr << "Skip " << kind << " " << link.path
+                << ": points outside of HTML directory" << std::endl;
+      return;
+    }
+    const auto it = links.find(target);
+    if (it == links.end())
+      break;
+    current = &it->second;
+  }
+
+  if (target.empty() || directories.count(target)) {
+    std::cerr << "Skip " << kind << " " << link.path
+              << ": points to a directory" << std::endl;
+    return;
+  }
+
+  if (!entryPaths.count(target)) {
+    std::cerr << "Unable to resolve " << kind << " " << link.path
+              << ": No such file or directory" << std::endl;
+    return;
+  }
+
+  entryPaths.insert(link.path);
+  addRedirection(link.path, "", target);
+}
+
+void ZimCreatorFS::addPendingFiles(PendingFiles& pendingFiles, size_t maxCount)
+{
+  while ( !pendingFiles.empty()
+          && (pendingFiles.size() > maxCount
+              || pendingFiles.front().wait_for(std::chrono::seconds(0)) == std::future_status::ready) ) {
+    addAnalyzedFile(pendingFiles.front().get());
+    pendingFiles.pop_front();
+  }
 }
 
 void ZimCreatorFS::addFile(const std::string& path)
 {
   auto url = path.substr(directoryPath.size()+1);
-  auto mimetype = getMimeTypeForFile(directoryPath, url);
+  addAnalyzedFile(analyzeFile(path, std::string(getMimeTypeFromExtension(getFileExtension(url)))));
+}
+
+// Returns the url of the inflated version of a compressed asset (style.css
+// for style.css.gz), or "" if url isn't the one of a compressed asset
+std::string getInflatedAssetUrl(const std::string& url)
+{
+  if (asciitolower(getFileExtension(url)) != "gz")
+    return "";
+
+  const auto inflatedUrl = url.substr(0, url.size() - 3);
+  return getMimeTypeFromExtension(getFileExtension(inflatedUrl)).empty() ? "" : inflatedUrl;
+}
+
+bool ZimCreatorFS::inflateFile(const std::string& path, std::string& content) const
+{
+  try {
+    return inflateFileContent(path, content);
+  } catch (const std::runtime_error&) {
+    ++inflateFailureCount;
+    return false;
+  }
+}
+
+ZimCreatorFS::AnalyzedFile ZimCreatorFS::analyzeFile(const std::string& path, std::string mimetype) const
+{
+  auto url = path.substr(directoryPath.size()+1);
   auto title = std::string{};
-  zim::writer::Hints hints;
+  AnalyzedFile file;
+
+  // The inflated content of the file (if inflateHtmlFlag is set and the
+  // file is a compressed HTML page or asset)
+  std::string content;
+  bool inflated = false;
+  if (inflateHtmlFlag) {
+    const auto inflatedUrl = getInflatedAssetUrl(url);
+    // The asset is left as is if its uncompressed version is there as well
+    if (!inflatedUrl.empty() && !fileExists(directoryPath + "/" + inflatedUrl)
+        && inflateFile(path, content)) {
+      inflated = true;
+      url = inflatedUrl;
+      mimetype = getMimeTypeFromExtension(getFileExtension(url));
+    }
+  }
+  // The beginning of the file, read once to detect its mimetype and to
+  // scan its head
+  std::string fileStart;
+  bool fileStartRead = false;
+  if ( mimetype.empty() ) {
+    fileStart = readFileStart(path);
+    fileStartRead = true;
+    mimetype = getMimeTypeFromContent(fileStart);
+  }
 
-  std::shared_ptr<zim::writer::Item> item;
   if ( mimetype.find("text/html") != std::string::npos ) {
-    auto content = getFileContent(path);
-
-    if (mimetype.find("text/html") != std::string::npos) {
-      hints[zim::writer::FRONT_ARTICLE] = 1;
-      auto redirectUrl = parseAndAdaptHtml(content, title, url);
-      if (!redirectUrl.empty()) {
-        // This is a redirect.
-        addRedirection(url, title, redirectUrl, hints);
-        return;
+    if (inflateHtmlFlag && !inflated) {
+      inflated = inflateFile(path, content);
+    }
+    // Only the head of the page is needed here. Unless it is inflated, the
+    // content is read by the libzim worker compressing it (FileItem).
+    HtmlHead head;
+    bool headScanned = false;
+    if (!inflated) {
+      if (!fileStartRead) {
+        fileStart = readFileStart(path);
       }
+      content = getHtmlFileHead(path, std::move(fileStart), head, headScanned);
+    }
+
+    file.hints[zim::writer::FRONT_ARTICLE] = 1;
+    auto redirectUrl = parseAndAdaptHtml(content, title, url, headScanned ? &head : nullptr);
+    if (!redirectUrl.empty()) {
+      // This is a redirect.
+      file.redirect = Redirect{url, title, redirectUrl};
+      return file;
+    }
+  }
+
+  if (inflated) {
+    file.item = zim::writer::StringItem::create(url, mimetype, title, file.hints, content);
+  } else {
+    file.item = std::make_shared<zim::writer::FileItem>(url, mimetype, title, file.hints, path);
+    if (deduplicate && !getFileDigest(path, file.digest, file.size)) {
+      file.digest.clear();
     }
+  }
+  return file;
+}
 
-    item = zim::writer::StringItem::create(url, mimetype, title, hints, content);
+void ZimCreatorFS::addAnalyzedFile(AnalyzedFile file)
+{
+  if (file.item) {
+    entryPaths.insert(file.item->getPath());
+    if (!addDuplicate(file)) {
+      addItem(file.item);
+    }
   } else {
-    item = std::make_shared<zim::writer::FileItem>(url, mimetype, title, hints, path);
+    addCheckedRedirection(file.redirect, file.hints, true);
+  }
+}
+
+bool ZimCreatorFS::addDuplicate(const AnalyzedFile& file)
+{
+  if (file.digest.empty())
+    return false;
+
+  const ContentKey key(file.size, file.digest, file.item->getMimeType());
+  const auto it = addedContents.find(key);
+  if (it == addedContents.end()) {
+    addedContents.emplace(key, file.item->getPath());
+    return false;
+  }
+
+  addAlias(file.item->getPath(), file.item->getTitle(), it->second, file.hints);
+  ++duplicateCount;
+  return true;
+}
+
+void ZimCreatorFS::addCheckedRedirection(const Redirect& redirect, const zim::writer::Hints& hints, bool fromHtml)
+{
+  entryPaths.insert(redirect.path);
+  if (entryPaths.find(redirect.target) == entryPaths.end()) {
+    uncheckedRedirects.push_back(UncheckedRedirect{redirect, fromHtml});
+  }
+  addRedirection(redirect.path, redirect.title, redirect.target, hints);
+}
+
+void ZimCreatorFS::checkRedirectTargets() const
+{
+  for (const auto& unchecked : uncheckedRedirects) {
+    const auto& redirect = unchecked.redirect;
+    if (entryPaths.find(redirect.target) != entryPaths.end())
+      continue;
+
+    if (unchecked.fromHtml) {
+      throw std::runtime_error("'" + redirect.path + "' HTML redirection target path '"
+                               + directoryPath + "/" + redirect.target + "' doesn't exist.");
+    }
+    std::cerr << "zimwriterfs: target '" << redirect.target << "' of redirect '"
+              << redirect.path << "' doesn't exist" << std::endl;
   }
-  addItem(item);
 }
 
 void ZimCreatorFS::processSymlink(const std::string& curdir, const std::string& symlink_path)
@@ -228,6 +762,7 @@ void ZimCreatorFS::processSymlink(const std::string& curdir, const std::string&
 
   std::string source_url = symlink_path.substr(directoryPath.size() + 1);
   std::string target_url = std::string(resolved).substr(canonical_basedir.size() + 1);
+  entryPaths.insert(source_url);
   addRedirection(source_url, "", target_url);
 }
 
@@ -257,77 +792,75 @@ struct GumboOutputDestructor {
   GumboOutput* output;
 };
 
-std::string ZimCreatorFS::parseAndAdaptHtml(std::string& data, std::string& title, const std::string& url)
+// Reads the head of the HTML document with Gumbo (returns false if the
+// document has no head)
+bool parseHtmlHead(const std::string& data, HtmlHead& head)
 {
   GumboOutput* output = gumbo_parse(data.c_str());
   GumboOutputDestructor outputDestructor(output);
   GumboNode* root = output->root;
 
-  /* Search the content of the <title> tag in the HTML */
   if (root->type == GUMBO_NODE_ELEMENT
       && root->v.element.children.length >= 2) {
     const GumboVector* root_children = &root->v.element.children;
-    GumboNode* head = NULL;
     for (unsigned int i = 0; i < root_children->length; ++i) {
       GumboNode* child = (GumboNode*)(root_children->data[i]);
       if (child->type == GUMBO_NODE_ELEMENT
           && child->v.element.tag == GUMBO_TAG_HEAD) {
-        head = child;
-        break;
+        readHtmlHead(&child->v.element.children, head);
+        return true;
       }
     }
+  }
+  return false;
+}
 
-    if (head != NULL) {
-      GumboVector* head_children = &head->v.element.children;
-      for (unsigned int i = 0; i < head_children->length; ++i) {
-        GumboNode* child = (GumboNode*)(head_children->data[i]);
-        if (child->type == GUMBO_NODE_ELEMENT
-            && child->v.element.tag == GUMBO_TAG_TITLE) {
-          if (child->v.element.children.length == 1) {
-            GumboNode* title_text
-                = (GumboNode*)(child->v.element.children.data[0]);
-            if (title_text->type == GUMBO_NODE_TEXT) {
-              title = title_text->v.text.text;
-              stripTitleInvalidChars(title);
-            }
-          }
-        }
-      }
+std::string ZimCreatorFS::parseAndAdaptHtml(std::string& data, std::string& title, const std::string& url,
+                                            const HtmlHead* scannedHead) const
+{
+  /* Only the head is needed: it is scanned without building the DOM of the
+     page unless the page needs a real HTML parser */
+  HtmlHead parsedHead;
+  if (!scannedHead) {
+    if (!scanHtmlHead(data, parsedHead) && !parseHtmlHead(data, parsedHead)) {
+      return "";
+    }
+  }
+  const HtmlHead& head = scannedHead ? *scannedHead : parsedHead;
 
-      /* Detect if this is a HTML redirection (if no redirects TSV
-         file specified)
-       */
-      std::string targetUrl;
-      try {
-        targetUrl = extractRedirectUrlFromHtml(head_children);
-      } catch (const std::runtime_error& error) {
-        std::cerr << error.what() << std::endl;
-      }
-      if (!targetUrl.empty()) {
-        auto redirectUrl = computeAbsolutePath(url, decodeUrl(targetUrl));
-        auto redirectUrlPath = directoryPath + "/" + redirectUrl;
-        if (!fileExists(redirectUrlPath)) {
-          throw std::runtime_error("'" + url + "' HTML redirection target path '"
-                                   + redirectUrlPath + "' doesn't exist.");
-        }
-        return redirectUrl;
-      }
+  /* The content of the <title> tag in the HTML */
+  if (!head.title.empty()) {
+    title = head.title;
+    stripTitleInvalidChars(title);
+  }
 
-      /* If no title, then compute one from the filename */
-      if (title.empty()) {
-        auto found = url.rfind("/");
-        if (found != std::string::npos) {
-          title = url.substr(found + 1);
-          found = title.rfind(".");
-          if (found != std::string::npos) {
-            title = title.substr(0, found);
-          }
-        } else {
-          title = url;
-        }
-        std::replace(title.begin(), title.end(), '_', ' ');
+  /* Detect if this is a HTML redirection (if no redirects TSV
+     file specified)
+   */
+  std::string targetUrl;
+  try {
+    targetUrl = extractRedirectUrlFromHtmlHead(head);
+  } catch (const std::runtime_error& error) {
+    std::cerr << error.what() << std::endl;
+  }
+  if (!targetUrl.empty()) {
+    // The existence of the target is checked by checkRedirectTargets()
+    return computeAbsolutePath(url, decodeUrl(targetUrl));
+  }
+
+  /* If no title, then compute one from the filename */
+  if (title.empty()) {
+    auto found = url.rfind("/");
+    if (found != std::string::npos) {
+      title = url.substr(found + 1);
+      found = title.rfind(".");
+      if (found != std::string::npos) {
+        title = title.substr(0, found);
       }
+    } else {
+      title = url;
     }
+    std::replace(title.begin(), title.end(), '_', ' ');
   }
   return "";
 }
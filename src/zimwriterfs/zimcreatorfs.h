@@ -21,27 +21,67 @@
 #ifndef OPENZIM_ZIMWRITERFS_ZIMCREATORFS_H
 #define OPENZIM_ZIMWRITERFS_ZIMCREATORFS_H
 
+#include <atomic>
 #include <vector>
+#include <deque>
+#include <future>
 #include <string>
+#include <string_view>
 #include <functional>
+#include <map>
+#include <tuple>
+#include <unordered_set>
 
 #include <zim/writer/creator.h>
 
+#include "tarreader.h"
+
+struct HtmlHead;
+
+struct Redirect {
+  std::string path, title, target;
+};
+
 class ZimCreatorFS : public zim::writer::Creator
 {
  public:
+  // _directoryPath is empty if the content comes from a tar archive
   ZimCreatorFS(std::string _directoryPath);
-  virtual ~ZimCreatorFS() = default;
+  virtual ~ZimCreatorFS();
 
   virtual void add_redirectArticles_from_file(const std::string& path);
+  // Adds the content of the directory tree. The tree is crawled and the
+  // HTML files are parsed by worker threads. The items are added in the
+  // order of the crawl (the entries of each directory sorted by name, the
+  // subdirectories depth first), whatever the number of threads.
   virtual void visitDirectory(const std::string& path);
+  // Adds the content of a tar archive read sequentially from in. The files
+  // are added from memory (the big ones are spooled to temporary files
+  // first) and the links become redirections, like the symlinks of a
+  // directory.
+  virtual void visitTar(std::istream& in);
+  void setCrawlerThreadCount(unsigned count) { crawlerThreadCount = count; }
+  void setHtmlWorkerCount(unsigned count) { htmlWorkerCount = count; }
+  // Adds the files whose content is the same as the one of a file already
+  // added as aliases of its item (sharing its content)
+  void setDeduplication(bool enabled) { deduplicate = enabled; }
 
   virtual void addFile(const std::string& path);
 
   void processSymlink(const std::string& curdir, const std::string& symlink_path);
+
+  // Checks that the targets of the redirections added from the HTML pages
+  // and the redirects file are in the archive (to be called once all the
+  // entries are added). The dangling redirections of the redirects file are
+  // reported on stderr, the first one of an HTML page is thrown
+  // (std::runtime_error).
+  void checkRedirectTargets() const;
   const std::string & basedir() const { return directoryPath; }
   const std::string & canonicalBaseDir() const { return canonical_basedir; }
-  std::string parseAndAdaptHtml(std::string& data, std::string& title, const std::string& url);
+  // Reads the title and the redirection of an HTML page from its head,
+  // which is scanned (or parsed) from data unless scannedHead is given
+  std::string parseAndAdaptHtml(std::string& data, std::string& title, const std::string& url,
+                                const HtmlHead* scannedHead = nullptr) const;
 
   void addMetadata(const std::string& key, const std::string& content) {
     if ( !content.empty() ) {
@@ -49,16 +89,88 @@ class ZimCreatorFS : public zim::writer::Creator
     }
   }
 
- private:
+ private: // types
+  // What has to be added to the archive for a file: an item or (for HTML
+  // redirection pages) a redirection
+  struct AnalyzedFile {
+    std::shared_ptr<zim::writer::Item> item;
+    Redirect redirect;
+    zim::writer::Hints hints;
+
+    // For the deduplication of the items read from a file (empty digest
+    // otherwise)
+    std::string digest;
+    uint64_t size = 0;
+  };
+
+  // Identifies the items having the same content
+  typedef std::tuple<uint64_t, std::string, std::string> ContentKey;  // size, SHA-256, mimetype
+
+  typedef std::deque<std::future<AnalyzedFile>> PendingFiles;
+
+  struct UncheckedRedirect {
+    Redirect redirect;
+    bool fromHtml;
+  };
+
+ private: // functions
+  // Reads and parses (if HTML) a file, detecting its mimetype if empty.
+  // With inflateHtmlFlag, compressed HTML pages and assets (like
+  // style.css.gz, added as style.css) are inflated. Can be called from any
+  // thread.
+  AnalyzedFile analyzeFile(const std::string& path, std::string mimetype) const;
+
+  // Same as analyzeFile() for a file of a tar archive, from its content or,
+  // if it was too big to be kept in memory, from the temporary file it was
+  // spooled to (content is then only its beginning)
+  AnalyzedFile analyzeTarMember(const std::string& url, std::string content,
+                                std::string mimetype, const std::string& spoolPath) const;
+  std::string spoolTarMember(TarReader& tar, const std::string& head);
+  void addTarLink(const TarReader::Member& link,
+                  const std::map<std::string, TarReader::Member>& links,
+                  const std::unordered_set<std::string>& directories);
+
+  // Inflates the file at path into content. The failures are counted.
+  bool inflateFile(const std::string& path, std::string& content) const;
+  void addAnalyzedFile(AnalyzedFile file);
+  // Adds the item of file as an alias of an item of same content (if any)
+  bool addDuplicate(const AnalyzedFile& file);
+
+  // Adds a redirection, remembering its path and, if it isn't in the
+  // archive yet, its target
+  void addCheckedRedirection(const Redirect& redirect, const zim::writer::Hints& hints, bool fromHtml);
+
+  // Adds the analyzed files at the front of pendingFiles (in order), waiting
+  // for their analysis as long as there are more than maxCount of them
+  void addPendingFiles(PendingFiles& pendingFiles, size_t maxCount);
+
+ private: // data
   std::string directoryPath;  ///< html dir without trailing slash
   std::string canonical_basedir;
-};
+  unsigned crawlerThreadCount = 4;
+  unsigned htmlWorkerCount = 4;
+  bool deduplicate = false;
+  // Files that couldn't be inflated (reported by visitDirectory())
+  mutable std::atomic<size_t> inflateFailureCount{0};
 
-struct Redirect {
-  std::string path, title, target;
+  // Paths of the entries added from the directory and the redirects file
+  std::unordered_set<std::string> entryPaths;
+  // Redirections whose target wasn't added when they were
+  std::vector<UncheckedRedirect> uncheckedRedirects;
+  // Path of the first item added for every content (with deduplicate)
+  std::map<ContentKey, std::string> addedContents;
+  size_t duplicateCount = 0;
+  // Temporary files holding the big files of a tar archive
+  std::string spoolDirectory;
+  std::vector<std::string> spooledFiles;
 };
 
 using redirect_handler = std::function<void(Redirect)>;
-void parse_redirectArticles(std::istream& in_stream, redirect_handler handler);
+// Parses the lines of a redirects TSV file (path, title, target), passing
+// them to handler in order. threadCount threads validate parts of data in
+// parallel. Throws std::runtime_error on an invalid line (after handling
+// the lines before it).
+void parse_redirectArticles(std::string_view data, redirect_handler handler, unsigned threadCount = 1);
+void parse_redirectArticles(std::istream& in_stream, redirect_handler handler, unsigned threadCount = 1);
 
 #endif  // OPENZIM_ZIMWRITERFS_ARTICLESOURCE_H
@@ -31,6 +31,8 @@
 #include <magic.h>
 #include <cstdio>
 #include <queue>
+#include <fstream>
+#include <iostream>
 
 #include "zimcreatorfs.h"
 #include "../metadata.h"
@@ -59,11 +61,13 @@ std::string directoryPath;
 
 
 int threads = 4;
+int htmlThreads = 4;
 zim::size_type clusterSize = 2048*1024;
 
 bool verboseFlag = false;
 bool withoutFTIndex = false;
 bool noUuid = false;
+bool dedup = false;
 bool dontCheckArgs = false;
 bool continue_without_magic = false;
 
@@ -85,6 +89,19 @@ bool thereAreMissingArguments()
       || illustration.empty();
 }
 
+// HTML_DIRECTORY may also be a tar archive ("-" for the standard input)
+bool isTarInput()
+{
+  return directoryPath == "-"
+      || (fileExists(directoryPath) && !isDirectory(directoryPath));
+}
+
+// The illustration of a tar archive is taken from the file system
+std::string getIllustrationPath()
+{
+  return isTarInput() ? illustration : directoryPath + "/" + illustration;
+}
+
 zim::Metadata makeMetadata() {
   zim::Metadata metadata;
 
@@ -101,7 +118,7 @@ zim::Metadata makeMetadata() {
   metadata.set("Tags",            tags);
   metadata.set("Date",            generateDate());
   if ( !illustration.empty() )  {
-    const auto data = getFileContent(directoryPath + "/" + illustration);
+    const auto data = getFileContent(getIllustrationPath());
     metadata.set("Illustration_48x48@1", data, "image/png");
   }
 
@@ -142,8 +159,6 @@ bool inflateHtmlFlag = false;
 
 pthread_mutex_t verboseMutex;
 
-magic_t magic;
-
 bool isVerbose()
 {
   pthread_mutex_lock(&verboseMutex);
@@ -169,7 +184,7 @@ void usage()
 
   std::cout << "Purpose:" << std::endl;
   std::cout << "\tPacking all files (HTML/JS/CSS/JPEG/WEBM/...) belonging to a "
-               "directory in a ZIM file."
+               "directory (or to a tar archive) in a ZIM file."
             << std::endl;
   std::cout << std::endl;
 
@@ -178,7 +193,8 @@ void usage()
                "must be relative to HTML_DIRECTORY."
             << std::endl;
   std::cout << "\t-I, --illustration\tpath of ZIM file illustration. The path must be "
-               "relative to HTML_DIRECTORY and the image a 48x48 PNG."
+               "relative to HTML_DIRECTORY (to the current directory if HTML_DIRECTORY "
+               "is a tar archive) and the image a 48x48 PNG."
             << std::endl;
   std::cout << "\t-l, --language\t\tlanguage code of the content in ISO639-3"
             << std::endl;
@@ -193,7 +209,8 @@ void usage()
             << std::endl;
   std::cout << std::endl;
   std::cout << "\tHTML_DIRECTORY\t\tpath of the directory containing "
-               "the HTML pages you want to put in the ZIM file."
+               "the HTML pages you want to put in the ZIM file, or of a tar "
+               "archive of it (- to read the archive from the standard input)."
             << std::endl;
   std::cout << "\tZIM_FILE\t\tpath of the ZIM file you want to obtain."
             << std::endl;
@@ -211,8 +228,15 @@ void usage()
       << std::endl;
   std::cout << "\t-J, --threads\t\tcount of threads to utilize (default: 4)"
       << std::endl;
-  std::cout << "\t-x, --inflateHtml\ttry to inflate HTML files before packing "
-               "(*.html, *.htm, ...)"
+  std::cout << "\t--htmlThreads\t\tcount of threads parsing the HTML files and the redirects, detecting mimetypes and inflating files (default: 4)"
+      << std::endl;
+  std::cout << "\t-x, --inflateHtml\ttry to inflate HTML files (*.html, *.htm, ...) "
+               "and compressed assets (*.css.gz, *.js.gz, ...) before packing. "
+               "The assets are added without their .gz suffix."
+            << std::endl;
+  std::cout << "\t--dedup\t\t\tstore the content of identical files once "
+               "(the duplicates are added as aliases of the first file). "
+               "Ignored for a tar archive."
             << std::endl;
   std::cout << "\t-r, --redirects\t\tpath to a TSV file containing a list of "
                "redirects (url title target_url)."
@@ -272,6 +296,8 @@ void parse_args(int argc, char** argv)
          {"publisher", required_argument, 0, 'p'},
          {"withoutFTIndex", no_argument, 0, 'j'},
          {"threads", required_argument, 0, 'J'},
+         {"htmlThreads", required_argument, 0, 'T'},
+         {"dedup", no_argument, 0, 'D'},
          {"no-uuid", no_argument, 0, 'U'},
          {"dont-check-arguments", no_argument, 0, 'B'},
          {"skip-libmagic-check", no_argument, 0, 'M'},
@@ -357,6 +383,12 @@ void parse_args(int argc, char** argv)
         case 'J':
           threads = atoi(optarg);
           break;
+        case 'T':
+          htmlThreads = atoi(optarg);
+          break;
+        case 'D':
+          dedup = true;
+          break;
         case 'U':
           noUuid = true;
           break;
@@ -389,13 +421,20 @@ void parse_args(int argc, char** argv)
 
   /* Check arguments */
 
+  if (threads < 1 || htmlThreads < 1) {
+    std::cerr << "zimwriterfs: --threads and --htmlThreads must be at least 1"
+              << std::endl;
+    exit(1);
+  }
+
   // delete / from the end of filename
   if (directoryPath[directoryPath.length() - 1] == '/') {
     directoryPath = directoryPath.substr(0, directoryPath.length() - 1);
   }
 
   /* Check metadata */
-  if (!dontCheckArgs && !fileExists(directoryPath + "/" + welcome)) {
+  // The members of a tar archive are only known once it is read
+  if (!dontCheckArgs && !isTarInput() && !fileExists(directoryPath + "/" + welcome)) {
     std::cerr << "zimwriterfs: unable to find welcome page at '"
               << directoryPath << "/" << welcome
               << "'. --welcome path/value must be relative to HTML_DIRECTORY."
@@ -403,10 +442,10 @@ void parse_args(int argc, char** argv)
     exit(1);
   }
 
-  if (!dontCheckArgs && !fileExists(directoryPath + "/" + illustration)) {
-    std::cerr << "zimwriterfs: unable to find illustration at " << directoryPath
-              << "/" << illustration
-              << "'. --illustration path/value must be relative to HTML_DIRECTORY."
+  if (!dontCheckArgs && !fileExists(getIllustrationPath())) {
+    std::cerr << "zimwriterfs: unable to find illustration at " << getIllustrationPath()
+              << "'. --illustration path/value must be relative to "
+              << (isTarInput() ? "the current directory." : "HTML_DIRECTORY.")
               << std::endl;
     exit(1);
   }
@@ -429,11 +468,15 @@ void parse_args(int argc, char** argv)
 
 void create_zim(const zim::Metadata& metadata)
 {
-  ZimCreatorFS zimCreator(directoryPath);
+  const bool tarInput = isTarInput();
+  ZimCreatorFS zimCreator(tarInput ? "" : directoryPath);
   zimCreator.configVerbose(isVerbose())
             .configNbWorkers(threads)
             .configClusterSize(clusterSize)
             .configIndexing(!withoutFTIndex, language);
+  zimCreator.setCrawlerThreadCount(threads);
+  zimCreator.setHtmlWorkerCount(htmlThreads);
+  zimCreator.setDeduplication(dedup);
   if ( noUuid ) {
     zimCreator.setUuid(zim::Uuid());
   }
@@ -453,7 +496,7 @@ void create_zim(const zim::Metadata& metadata)
   }
 
   // Check that the resulting .zim file isn't located under source HTML directory
-  if (std::string(buf).find(zimCreator.canonicalBaseDir()) == 0) {
+  if (!tarInput && std::string(buf).find(zimCreator.canonicalBaseDir()) == 0) {
     throw std::invalid_argument(".zim file to create cannot be located inside of source HTML directory");
   }
 
@@ -466,7 +509,17 @@ void create_zim(const zim::Metadata& metadata)
   }
 
   /* Directory visitor */
-  zimCreator.visitDirectory(directoryPath);
+  if (!tarInput) {
+    zimCreator.visitDirectory(directoryPath);
+  } else if (directoryPath == "-") {
+    zimCreator.visitTar(std::cin);
+  } else {
+    std::ifstream tarStream(directoryPath, std::ios::binary);
+    if (!tarStream) {
+      throw std::runtime_error("Unable to open the tar archive " + directoryPath);
+    }
+    zimCreator.visitTar(tarStream);
+  }
 
   /* Check redirects file and read it if necessary*/
   if (!redirectsPath.empty()) {
@@ -483,6 +536,7 @@ void create_zim(const zim::Metadata& metadata)
       zimCreator.add_redirectArticles_from_file(redirectsPath);
     }
   }
+  zimCreator.checkRedirectTargets();
   zimCreator.finishZimCreation();
 }
 
@@ -493,13 +547,16 @@ int main(int argc, char** argv)
   parse_args(argc, argv);
 
   /* Init */
-  magic = magic_open(MAGIC_MIME);
+  /* Only checks that the magic file can be loaded: the mimetypes are
+     detected with a libmagic handle per thread (see tools.cpp) */
+  magic_t magic = magic_open(MAGIC_MIME);
   if (magic_load(magic, NULL) != 0) {
     std::cerr << "Impossible to load magic file. Set `MAGIC` environment variable to a `magic` (or `magic.mgc`) file." << std::endl;
     if (! continue_without_magic) {
       exit(1);
     }
   }
+  magic_close(magic);
   pthread_mutex_init(&verboseMutex, NULL);
 
   try {
@@ -516,7 +573,6 @@ int main(int argc, char** argv)
     exit(1);
   }
 
-  magic_close(magic);
   /* Destroy mutex */
   pthread_mutex_destroy(&verboseMutex);
 }
@@ -387,3 +387,37 @@ TEST(Metadata, counterRegexp){
   ASSERT_VALID_COUNTER("a/-=1");
   ASSERT_VALID_COUNTER("a/+=1");
 }
+
+TEST(Metadata, counterIsComparedWithActualCounts)
+{
+  zim::Metadata m = makeValidMetadata();
+  const zim::Metadata::MimeTypeCounter actualCounts{
+    {"image/png", 10},
+    {"text/html", 5}
+  };
+
+  // No Counter at all
+  ASSERT_EQ(m.checkCounter(actualCounts), zim::Metadata::Errors());
+
+  m.set("Counter", "text/html=5;image/png=10;");
+  ASSERT_EQ(m.checkCounter(actualCounts), zim::Metadata::Errors());
+
+  m.set("Counter", "text/html=4;application/javascript=2;image/png=10");
+  ASSERT_EQ(m.checkCounter(actualCounts),
+      zim::Metadata::Errors({
+        "Counter declares 2 application/javascript item(s) while the archive contains 0",
+        "Counter declares 4 text/html item(s) while the archive contains 5"
+      })
+  );
+
+  m.set("Counter", "text/html=5");
+  ASSERT_EQ(m.checkCounter(actualCounts),
+      zim::Metadata::Errors({
+        "Counter declares 0 image/png item(s) while the archive contains 10"
+      })
+  );
+
+  // Malformed Counter metadata is reported by check() only
+  m.set("Counter", "text/html=5;image/png");
+  ASSERT_EQ(m.checkCounter(actualCounts), zim::Metadata::Errors());
+}
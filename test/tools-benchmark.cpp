@@ -0,0 +1,205 @@
+// Micro-benchmarks of the string helpers of src/tools.cpp that are on the
+// hot paths of zimcheck, zimdump and zimwriterfs.
+//
+// Run with `meson test --benchmark` (or directly from the build directory).
+
+#include "../src/tools.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+typedef std::chrono::steady_clock Clock;
+
+// Accumulates the results of the benchmarked functions so that the compiler
+// cannot optimize their calls away
+volatile size_t sink = 0;
+
+// Calls f on every input repeatedly for about the given time and prints
+// the average time per call
+template<class Input, class F>
+void benchmark(const std::string& name, const std::vector<Input>& inputs, F f,
+               std::chrono::milliseconds duration = std::chrono::milliseconds(300))
+{
+  size_t calls = 0;
+  size_t result = 0;
+  const auto start = Clock::now();
+  do {
+    for (const auto& input : inputs) {
+      result += f(input);
+    }
+    calls += inputs.size();
+  } while (Clock::now() - start < duration);
+
+  const std::chrono::duration<double, std::nano> elapsed(Clock::now() - start);
+  sink = sink + result;
+  std::cout << std::left << std::setw(48) << name
+            << std::right << std::fixed << std::setprecision(1)
+            << std::setw(10) << elapsed.count() / calls << " ns/call" << std::endl;
+}
+
+const std::vector<std::string> plainUrls = {
+  "A/Main_Page",
+  "../I/m/Wikipedia-logo-v2.svg.png.webp",
+  "https://en.wikipedia.org/wiki/Kiwix",
+  "-/s/css_modules/ext.cite.ux-enhancements.css",
+  "Tour_Eiffel#Histoire",
+};
+
+const std::vector<std::string> escapedUrls = {
+  "A/Caf%C3%A9_de_Flore",
+  "../I/m/%E2%80%9CQuote%E2%80%9D.jpg",
+  "https://example.com/search?q=example%20search%2Bmore",
+  "%D0%9C%D0%B0%D1%81%D0%BA%D0%B2%D0%B0",
+  "Tour_Eiffel%23Histoire",
+};
+
+const std::vector<std::string> attributeValues = {
+  "/R&amp;D",
+  "https://example.com/getlogo?w=640&amp;h=480",
+  "../syntax/&lt;script&gt;",
+  "Caf&eacute;_de_Flore&#x2F;menu",
+  "../I/m/Wikipedia-logo-v2.svg.png.webp",
+};
+
+// (base path, target path) pairs like the redirects dumped by zimdump
+const std::vector<std::pair<std::string, std::string>> pathPairs = {
+  { "A/Paris", "A/Paris_(France)" },
+  { "Eiffel_Tower", "Tour_Eiffel" },
+  { "wiki/Category/Cities", "wiki/Paris" },
+  { "A/B/c/d", "A/B/e/" },
+  { "A/B/c/", "../../I/m/logo.png" },
+};
+
+const std::vector<std::string> links = {
+  "../I/m/Wikipedia-logo-v2.svg.png.webp",
+  "https://en.wikipedia.org/wiki/Kiwix",
+  "//upload.wikimedia.org/wikipedia/commons/a/a9/Example.jpg",
+  "mailto:contact@kiwix.org",
+  "javascript:void(0)",
+  "data:image/png;base64,iVBORw0KGgo=",
+  "#cite_note-1",
+  "Tour_Eiffel",
+};
+
+const std::vector<std::string> asciiTitles = {
+  "Main Page",
+  "Eiffel Tower",
+  "List of highest mountains on Earth",
+  "Kiwix",
+};
+
+const std::vector<std::string> unicodeTitles = {
+  "Café de Flore",
+  "Κίουι",
+  "Москва",
+  "हिन्दी",
+};
+
+const std::vector<std::string> unicodePaths = {
+  "A/Main_Page",
+  "A/Café_de_Flore",
+  "A/Κίουι",
+  "I/m/“Quote”.jpg",
+  "A/Масква",
+};
+
+// An article with links to the old namespaces to be rewritten by zimrecreate
+std::string makeOldNamespaceArticle()
+{
+  std::string html = "<html><head><link rel=\"stylesheet\" href=\"../-/s/style.css\"></head><body>";
+  for (int i = 0; i < 200; ++i) {
+    html += "<p>Some text about <a href=\"../A/Article_" + std::to_string(i) + "\">article</a> ";
+    html += "and an image <img src='../../I/m/image_" + std::to_string(i) + ".png'>.</p>";
+  }
+  return html + "</body></html>";
+}
+
+MultiStringReplacer::Replacements oldNamespaceRewrites()
+{
+  MultiStringReplacer::Replacements replacements;
+  for (std::string prefix: {"'", "\""}) {
+    for (auto ns : {'A','I','J','-'}) {
+      replacements.emplace_back(prefix+"../../"+ns+"/", prefix+"../");
+      replacements.emplace_back(prefix+"../"+ns+"/", prefix);
+    }
+  }
+  return replacements;
+}
+
+// Binary data like the images embedded in data: URIs
+std::string makeBinaryData(size_t size)
+{
+  std::string data(size, '\0');
+  uint32_t x = 12345;
+  for (auto& c : data) {
+    x = x * 1103515245 + 12345;
+    c = char(x >> 16);
+  }
+  return data;
+}
+
+} // unnamed namespace
+
+int main()
+{
+  benchmark("decodeUrl (no escapes)", plainUrls,
+            [](const std::string& s) { return decodeUrl(s).size(); });
+  benchmark("decodeUrl (escapes)", escapedUrls,
+            [](const std::string& s) { return decodeUrl(s).size(); });
+  benchmark("decodeHtmlEntities", attributeValues,
+            [](const std::string& s) { return decodeHtmlEntities(s, true).size(); });
+  benchmark("html_link::detectUriKind", links,
+            [](const std::string& s) { return size_t(html_link::detectUriKind(s)); });
+  benchmark("getTextLength (ASCII)", asciiTitles,
+            [](const std::string& s) { return getTextLength(s); });
+  benchmark("getTextLength (non-ASCII)", unicodeTitles,
+            [](const std::string& s) { return getTextLength(s); });
+  benchmark("computeRelativePath", pathPairs,
+            [](const std::pair<std::string, std::string>& p) {
+              return computeRelativePath(p.first, p.second).size();
+            });
+  benchmark("computeAbsolutePath", pathPairs,
+            [](const std::pair<std::string, std::string>& p) {
+              return computeAbsolutePath(p.first, p.second).size();
+            });
+  benchmark("urlEncode", unicodePaths,
+            [](const std::string& s) { return urlEncode(s, true).size(); });
+  const std::vector<std::string> articles = { makeOldNamespaceArticle() };
+  const auto rewrites = oldNamespaceRewrites();
+  benchmark("replaceStringInPlace (16 patterns)", articles,
+            [&rewrites](const std::string& s) {
+              std::string content = s;
+              for (const auto& r : rewrites)
+                replaceStringInPlace(content, r.first, r.second);
+              return content.size();
+            });
+  const MultiStringReplacer replacer(rewrites);
+  benchmark("MultiStringReplacer (16 patterns)", articles,
+            [&replacer](const std::string& s) { return replacer.replace(s).size(); });
+  const std::vector<std::string> binaryData = { makeBinaryData(64*1024) };
+  const std::vector<std::string> encodedData = { base64_encode(binaryData[0]) };
+  for ( const bool vectorized : { true, false } ) {
+    if ( useVectorizedBase64(vectorized) != vectorized )
+      continue;
+    const std::string impl = vectorized ? "vectorized" : "scalar";
+    benchmark("base64_encode (64 KiB, " + impl + ")", binaryData,
+              [](const std::string& s) { return base64_encode(s).size(); });
+    benchmark("base64_decode (64 KiB, " + impl + ")", encodedData,
+              [](const std::string& s) {
+                std::string decoded;
+                base64_decode(s, decoded);
+                return decoded.size();
+              });
+  }
+  useVectorizedBase64(true);
+  benchmark("httpRedirectHtml", unicodePaths,
+            [](const std::string& s) { return httpRedirectHtml(s).size(); });
+  return 0;
+}
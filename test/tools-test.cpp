@@ -1,9 +1,9 @@
 #include "gtest/gtest.h"
 #include "../src/tools.h"
-#include <magic.h>
+#include "../src/arena.h"
 #include <unordered_map>
+#include <thread>
 
-magic_t magic;
 bool inflateHtmlFlag = false;
 bool isVerbose() { return false; }
 
@@ -20,6 +20,99 @@ TEST(CommonTools, base64_encode)
   EXPECT_EQ(txt, "/wB6");
 }
 
+TEST(CommonTools, base64_encode_string_view)
+{
+  // Test vectors from RFC 4648
+  EXPECT_EQ(base64_encode(""), "");
+  EXPECT_EQ(base64_encode("f"), "Zg==");
+  EXPECT_EQ(base64_encode("fo"), "Zm8=");
+  EXPECT_EQ(base64_encode("foo"), "Zm9v");
+  EXPECT_EQ(base64_encode("foob"), "Zm9vYg==");
+  EXPECT_EQ(base64_encode("fooba"), "Zm9vYmE=");
+  EXPECT_EQ(base64_encode("foobar"), "Zm9vYmFy");
+
+  // Long enough for the vectorized loop
+  EXPECT_EQ(base64_encode("The quick brown fox jumps over the lazy dog"),
+            "VGhlIHF1aWNrIGJyb3duIGZveCBqdW1wcyBvdmVyIHRoZSBsYXp5IGRvZw==");
+  EXPECT_EQ(base64_encode(std::string("\xfb\xff\xbf\x00\x10\x83", 6) + std::string(12, '\xff')),
+            "+/+/ABCD////////////////");
+}
+
+TEST(CommonTools, base64_decode)
+{
+  std::string decoded;
+  EXPECT_TRUE(base64_decode("", decoded));
+  EXPECT_EQ(decoded, "");
+  EXPECT_TRUE(base64_decode("Zm9vYmFy", decoded));
+  EXPECT_EQ(decoded, "foobar");
+  EXPECT_TRUE(base64_decode("Zm9vYg==", decoded));
+  EXPECT_EQ(decoded, "foob");
+  EXPECT_TRUE(base64_decode("Zm9vYmE=", decoded));
+  EXPECT_EQ(decoded, "fooba");
+  EXPECT_TRUE(base64_decode("/wB6", decoded));
+  EXPECT_EQ(decoded, std::string("\xff\x00\x7a", 3));
+
+  // Padding is optional and whitespace is ignored
+  EXPECT_TRUE(base64_decode("Zm9vYg", decoded));
+  EXPECT_EQ(decoded, "foob");
+  EXPECT_TRUE(base64_decode(" Zm9v\nYmE\r\n", decoded));
+  EXPECT_EQ(decoded, "fooba");
+
+  // Unused bits of the last character are ignored
+  EXPECT_TRUE(base64_decode("Zh==", decoded));
+  EXPECT_EQ(decoded, "f");
+
+  EXPECT_TRUE(base64_decode("VGhlIHF1aWNrIGJyb3duIGZveCBqdW1wcyBvdmVyIHRoZSBsYXp5IGRvZw==", decoded));
+  EXPECT_EQ(decoded, "The quick brown fox jumps over the lazy dog");
+
+  // Invalid base64
+  EXPECT_FALSE(base64_decode("Z", decoded));
+  EXPECT_FALSE(base64_decode("Zm9vY", decoded));
+  EXPECT_FALSE(base64_decode("Zm9v*mFy", decoded));
+  EXPECT_FALSE(base64_decode("Zm9vYg===", decoded));
+  EXPECT_FALSE(base64_decode("Zg=a", decoded));
+  EXPECT_FALSE(base64_decode("Zm9v_mFy-m9vYmFyZm9vYmFy", decoded)); // base64url
+  EXPECT_FALSE(base64_decode("VGhlIHF1aWNrIGJyb3duIGZveCBqdW1wcyBvdmVyIHRoZSBsYXp5IGRvZw!=", decoded));
+}
+
+TEST(CommonTools, base64_vectorized_and_scalar)
+{
+  // All the byte values, at all the positions of the 12/16 bytes blocks
+  std::string data;
+  for ( int i = 0; i < 1000; ++i )
+    data += char((i * 167) % 256);
+
+  std::vector<std::string> scalarEncoded;
+  ASSERT_FALSE(useVectorizedBase64(false));
+  for ( size_t size = 0; size < 100; ++size )
+    scalarEncoded.push_back(base64_encode(std::string_view(data).substr(size, size * 7)));
+
+  // Both implementations are tested (the vectorized one only if the CPU
+  // supports it)
+  for ( const bool vectorized : { false, true } ) {
+    const bool used = useVectorizedBase64(vectorized);
+    EXPECT_TRUE(used || !vectorized);
+    for ( size_t size = 0; size < 100; ++size ) {
+      const auto input = std::string_view(data).substr(size, size * 7);
+      const auto encoded = base64_encode(input);
+      ASSERT_EQ(encoded, scalarEncoded[size]) << "vectorized: " << used << ", size: " << input.size();
+
+      std::string decoded;
+      ASSERT_TRUE(base64_decode(encoded, decoded)) << "vectorized: " << used << ", size: " << input.size();
+      ASSERT_EQ(decoded, input) << "vectorized: " << used;
+
+      // An invalid character is detected wherever it is
+      for ( size_t pos = 0; pos < encoded.size(); pos += 5 ) {
+        std::string invalid = encoded;
+        invalid[pos] = (pos % 2 == 0) ? '*' : '-';
+        ASSERT_FALSE(base64_decode(invalid, decoded)) << "vectorized: " << used << ", pos: " << pos;
+      }
+    }
+  }
+
+  useVectorizedBase64(true);
+}
+
 TEST(CommonTools, decodeUrl)
 {
   std::string src = "%00";
@@ -159,6 +252,61 @@ TEST(CommonTools, replaceStringInPlace)
   EXPECT_EQ(str, "bbbcd");
 }
 
+TEST(CommonTools, MultiStringReplacer)
+{
+  const MultiStringReplacer r({
+      { "cat", "dog" },
+      { "category", "kind" },
+      { "at", "@" },
+      { "", "nothing" },
+      { "é", "e" },
+      { "cat", "ignored duplicate" },
+  });
+
+  EXPECT_EQ(r.replace(""), "");
+  EXPECT_EQ(r.replace("xyz"), "xyz");
+  EXPECT_EQ(r.replace("cat"), "dog");
+  EXPECT_EQ(r.replace("a cat sat"), "a dog s@");
+  EXPECT_EQ(r.replace("catcat"), "dogdog");
+
+  // The longest pattern starting at a given position wins
+  EXPECT_EQ(r.replace("category"), "kind");
+  EXPECT_EQ(r.replace("categor"), "dogegor");
+
+  // The leftmost match wins
+  EXPECT_EQ(r.replace("cattle"), "dogtle");
+  EXPECT_EQ(r.replace("ccat"), "cdog");
+
+  // Replacements aren't rescanned
+  EXPECT_EQ(MultiStringReplacer(MultiStringReplacer::Replacements{ { "a", "aa" } }).replace("aba"), "aabaa");
+  EXPECT_EQ(MultiStringReplacer(MultiStringReplacer::Replacements{ { "ab", "a" } }).replace("aabb"), "aab");
+
+  // Non-ASCII bytes
+  EXPECT_EQ(r.replace("Café été"), "Cafe ete");
+
+  // Appending to an existing string
+  std::string result = "> ";
+  r.replace("cat", result);
+  EXPECT_EQ(result, "> dog");
+
+  // Same as replaceStringInPlace() for a single pattern
+  std::string str = "aabcd";
+  replaceStringInPlace(str, "a", "b");
+  EXPECT_EQ(MultiStringReplacer(MultiStringReplacer::Replacements{ { "a", "b" } }).replace("aabcd"), str);
+
+  EXPECT_EQ(MultiStringReplacer({}).replace("abc"), "abc");
+
+  // Patterns using all the byte values
+  MultiStringReplacer::Replacements allBytes;
+  for ( int c = 0; c < 256; ++c )
+    allBytes.push_back({ std::string(1, char(c)) + "!", std::to_string(c) });
+  const MultiStringReplacer allBytesReplacer(allBytes);
+  std::string text = "\xff!a";
+  text += '\0';
+  text += "!b!\x01";
+  EXPECT_EQ(allBytesReplacer.replace(text), "255a098\x01");
+}
+
 TEST(CommonTools, stripTitleInvalidChars)
 {
   std::string str;
@@ -202,6 +350,22 @@ TEST(tools, uriKind)
     EXPECT_EQ(UriKind::DATA, uriKind("data:text/plain;charset=UTF-8,data"));
     EXPECT_EQ(UriKind::DATA, uriKind("DATA:text/plain;charset=UTF-8,data"));
 
+    EXPECT_EQ(UriKind::XMPP, uriKind("xmpp:kelson@kiwix.org"));
+    EXPECT_EQ(UriKind::XMPP, uriKind("XmPp:kelson@kiwix.org"));
+
+    EXPECT_EQ(UriKind::NEWS, uriKind("news:comp.os.linux.announce"));
+    EXPECT_EQ(UriKind::NEWS, uriKind("NEWS:comp.os.linux.announce"));
+
+    EXPECT_EQ(UriKind::URN, uriKind("urn:nbn:de:bsz:24-digibib-bsz3530416370"));
+    EXPECT_EQ(UriKind::URN, uriKind("URN:nbn:de:bsz:24-digibib-bsz3530416370"));
+
+    // Same length and first letter as special schemes
+    EXPECT_EQ(UriKind::GENERIC_URI, uriKind("tag:kiwix.org,2024:zim"));
+    EXPECT_EQ(UriKind::GENERIC_URI, uriKind("dict:word"));
+    EXPECT_EQ(UriKind::GENERIC_URI, uriKind("nntp:comp.os.linux.announce"));
+    EXPECT_EQ(UriKind::GENERIC_URI, uriKind("git+ssh:repo"));
+    EXPECT_EQ(UriKind::GENERIC_URI, uriKind("ge.:12.34,56.78"));
+
     EXPECT_EQ(UriKind::GENERIC_URI, uriKind("http:example.com"));
     EXPECT_EQ(UriKind::GENERIC_URI, uriKind("http:/example.com"));
     EXPECT_EQ(UriKind::OTHER, uriKind("git@github.com:openzim/zim-tools.git"));
@@ -476,6 +640,66 @@ TEST(tools, resolveLinkTarget)
     EXPECT_EQ(resolveLinkTarget("oops", "a/../../b/"),  "a/../../b/oops");
 }
 
+TEST(tools, linkTargetBatch)
+{
+    const InternalLinkResolver resolver("a/b/c.html");
+    LinkTargetBatch batch;
+    for (int page = 0; page < 2; ++page) {
+        batch.clear();
+        batch.add(resolver, "../d.html", 0);
+        batch.add(resolver, "x%2Fy.html#top", 1);
+        EXPECT_THROW(batch.add(resolver, "../../../e.html", 2), OutOfBoundsURL);
+        EXPECT_THROW(batch.add(resolver, "/f.html", 3), AbsolutePathURL);
+        batch.add(resolver, "./../d.html?q=1", 4);
+        batch.add(resolver, "", 5);
+
+        ASSERT_EQ(batch.links().size(), 4u);
+        EXPECT_EQ(batch.target(batch.links()[1]), "a/b/x/y.html");
+        // The links to the same target share its id
+        EXPECT_EQ(batch.targetCount(), 3u);
+        EXPECT_EQ(batch.links()[0].target, batch.links()[2].target);
+
+        batch.sortByTarget();
+        const auto& links = batch.links();
+        ASSERT_EQ(links.size(), 4u);
+        EXPECT_EQ(batch.target(links[0]), "a/b/c.html");
+        EXPECT_EQ(links[0].id, 5u);
+        EXPECT_EQ(batch.target(links[1]), "a/b/x/y.html");
+        EXPECT_EQ(links[1].id, 1u);
+        EXPECT_EQ(batch.target(links[2]), "a/d.html");
+        EXPECT_EQ(links[2].id, 0u);
+        EXPECT_EQ(batch.target(links[3]), "a/d.html");
+        EXPECT_EQ(links[3].id, 4u);
+        // The ids follow the order of the targets
+        EXPECT_EQ(links[0].target, 0u);
+        EXPECT_EQ(links[1].target, 1u);
+        EXPECT_EQ(links[2].target, 2u);
+        EXPECT_EQ(links[3].target, 2u);
+    }
+
+    // Enough distinct targets to grow the hash table, and the ids are
+    // reassigned on the next page
+    batch.clear();
+    for (size_t i = 0; i < 1000; ++i) {
+        batch.add(resolver, "t" + std::to_string(i % 500) + ".html", i);
+    }
+    ASSERT_EQ(batch.targetCount(), 500u);
+    batch.sortByTarget();
+    ASSERT_EQ(batch.links().size(), 1000u);
+    for (size_t i = 0; i < 1000; ++i) {
+        const auto& l = batch.links()[i];
+        EXPECT_EQ(l.target, i / 2);
+        EXPECT_EQ(batch.target(l), "a/b/t" + std::to_string(l.id % 500) + ".html");
+        if (i > 0) {
+            EXPECT_LE(batch.target(batch.links()[i - 1]), batch.target(l));
+        }
+    }
+    batch.clear();
+    batch.add(resolver, "t1.html", 0);
+    EXPECT_EQ(batch.targetCount(), 1u);
+    EXPECT_EQ(batch.links()[0].target, 0u);
+}
+
 TEST(tools, addler32)
 {
     EXPECT_EQ(adler32("sdfkhewruhwe8"), 640746832);
@@ -484,6 +708,55 @@ TEST(tools, addler32)
     EXPECT_EQ(adler32(""), 1);
 }
 
+TEST(tools, Arena)
+{
+  Arena arena(1024);
+
+  const auto s = arena.copy("hello");
+  EXPECT_EQ(s, "hello");
+  EXPECT_EQ(arena.copy(""), "");
+
+  void* const p = arena.allocate(8, 8);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % 8, 0u);
+
+  // Allocations larger than a quarter of a chunk get their own block
+  const auto big = arena.copy(std::string(1000, 'x'));
+  EXPECT_EQ(big, std::string(1000, 'x'));
+
+  // Many allocations spanning several chunks
+  std::vector<std::string_view> views;
+  for ( int i = 0; i < 1000; ++i ) {
+    views.push_back(arena.copy("string #" + std::to_string(i)));
+  }
+  for ( int i = 0; i < 1000; ++i ) {
+    ASSERT_EQ(views[i], "string #" + std::to_string(i));
+  }
+  EXPECT_EQ(s, "hello");
+
+  // The memory is reused after a reset
+  arena.reset();
+  EXPECT_EQ(arena.copy("world").data(), s.data());
+
+  std::vector<int, ArenaAllocator<int>> v{ArenaAllocator<int>(arena)};
+  for ( int i = 0; i < 100; ++i ) {
+    v.push_back(i);
+  }
+  EXPECT_EQ(v.size(), 100u);
+  EXPECT_EQ(v[99], 99);
+
+  // The large blocks are kept and reused after a reset (the smallest one
+  // big enough first)
+  Arena largeArena(1024);
+  void* const large1 = largeArena.allocate(2000);
+  void* const large2 = largeArena.allocate(500);
+  largeArena.reset();
+  EXPECT_EQ(largeArena.allocate(400), large2);
+  EXPECT_EQ(largeArena.allocate(400), large1);
+  void* const large3 = largeArena.allocate(400);
+  EXPECT_NE(large3, large1);
+  EXPECT_NE(large3, large2);
+}
+
 TEST(tools, decodeHtmlEntities)
 {
     EXPECT_EQ(decodeHtmlEntities(""),   "");
@@ -497,19 +770,58 @@ TEST(tools, decodeHtmlEntities)
 
     // All other HTML character references
     // (https://html.spec.whatwg.org/multipage/syntax.html#character-references)
-    // are NOT currently supported
-    EXPECT_EQ(decodeHtmlEntities("&nbsp;"), "&nbsp;");
-
-    // Capitalized versions of supported ones do NOT work
-    EXPECT_EQ(decodeHtmlEntities("&AMP;"), "&AMP;");
+    EXPECT_EQ(decodeHtmlEntities("&nbsp;"), "\u00A0");
+    EXPECT_EQ(decodeHtmlEntities("&eacute;"), "é");
+    EXPECT_EQ(decodeHtmlEntities("&notin;"), "∉");
+    EXPECT_EQ(decodeHtmlEntities("&CounterClockwiseContourIntegral;"), "∳");
+    EXPECT_EQ(decodeHtmlEntities("&NotNestedGreaterGreater;"), "⪢̸");
+    EXPECT_EQ(decodeHtmlEntities("&unknown;"), "&unknown;");
+    EXPECT_EQ(decodeHtmlEntities("&;"), "&;");
+
+    // Names are case sensitive (only some have a capitalized variant)
+    EXPECT_EQ(decodeHtmlEntities("&AMP;"), "&");
     EXPECT_EQ(decodeHtmlEntities("&aMP;"), "&aMP;");
-
-    // HTML entities of the form &#dd...; and/or &#xhh...; are NOT decoded
-    EXPECT_EQ(decodeHtmlEntities("&#65;"),  "&#65;" ); // should be "A"
-    EXPECT_EQ(decodeHtmlEntities("&#x41;"), "&#x41;"); // should be "A"
-
-    // Handling of "incomplete" entity
-    EXPECT_EQ(decodeHtmlEntities("&amp"), "&amp");
+    EXPECT_EQ(decodeHtmlEntities("&Eacute;"), "É");
+
+    // HTML entities of the form &#dd...; and/or &#xhh...;
+    EXPECT_EQ(decodeHtmlEntities("&#65;"),  "A");
+    EXPECT_EQ(decodeHtmlEntities("&#x41;"), "A");
+    EXPECT_EQ(decodeHtmlEntities("&#X2f;"), "/");
+    EXPECT_EQ(decodeHtmlEntities("&#x1F44B;"), "\U0001F44B");
+    EXPECT_EQ(decodeHtmlEntities("&#0065;"), "A");
+    EXPECT_EQ(decodeHtmlEntities("&#65"),   "A");
+    EXPECT_EQ(decodeHtmlEntities("&#65x"),  "Ax");
+    EXPECT_EQ(decodeHtmlEntities("&#;"),    "&#;");
+    EXPECT_EQ(decodeHtmlEntities("&#x;"),   "&#x;");
+    EXPECT_EQ(decodeHtmlEntities("&#xg;"),  "&#xg;");
+    EXPECT_EQ(decodeHtmlEntities("&#"),     "&#");
+    EXPECT_EQ(decodeHtmlEntities("&#0;"),        "�");
+    EXPECT_EQ(decodeHtmlEntities("&#xD800;"),    "�");
+    EXPECT_EQ(decodeHtmlEntities("&#x110000;"),  "�");
+    EXPECT_EQ(decodeHtmlEntities("&#99999999999999999999;"), "�");
+    EXPECT_EQ(decodeHtmlEntities("&#128;"),      "€"); // windows-1252
+    EXPECT_EQ(decodeHtmlEntities("&#x9F;"),      "Ÿ");
+
+    // Handling of "incomplete" entity: legacy names are recognized without
+    // the trailing semicolon (and take priority over unknown longer names)
+    EXPECT_EQ(decodeHtmlEntities("&amp"), "&");
+    EXPECT_EQ(decodeHtmlEntities("&notit;"), "¬it;");
+    EXPECT_EQ(decodeHtmlEntities("&copy2024"), "©2024");
+    EXPECT_EQ(decodeHtmlEntities("&nbsp"), "\u00A0");
+    EXPECT_EQ(decodeHtmlEntities("&apos"), "&apos");
+    EXPECT_EQ(decodeHtmlEntities("&"), "&");
+
+    // ... except in attribute values when followed by '=' or an alphanumeric
+    EXPECT_EQ(decodeHtmlEntities("?a=1&copy=2", true), "?a=1&copy=2");
+    EXPECT_EQ(decodeHtmlEntities("?a=1&copy2", true), "?a=1&copy2");
+    EXPECT_EQ(decodeHtmlEntities("?a=1&copy", true),  "?a=1©");
+    EXPECT_EQ(decodeHtmlEntities("?a=1&copy;=2", true), "?a=1©=2");
+    EXPECT_EQ(decodeHtmlEntities("?a=1&copy=2"), "?a=1©=2");
+
+    // Appending to a caller-provided buffer
+    std::string buffer = "x=";
+    decodeHtmlEntities("&lt;&#x3E;", buffer);
+    EXPECT_EQ(buffer, "x=<>");
 
     // No double decoding
     EXPECT_EQ(decodeHtmlEntities("&amp;lt;"), "&lt;");
@@ -584,6 +896,18 @@ TEST(tools, getLinks)
       "{ src, https://example.com/getlogo?w=640&h=480 }"
     );
 
+    // Truncated pages
+    EXPECT_LINKS(R"(<a href="/unterminated)", "");
+    EXPECT_LINKS(R"(<a href="/a"><img src)", "{ href, /a }");
+    EXPECT_LINKS(R"(<a href=)", "");
+
+    // Legacy character references without semicolon aren't decoded in
+    // query strings
+    EXPECT_LINKS(
+      R"(<a href="/search?q=x&copy=1&lang=en&amp;p=2&#x2F;3">search</a>)",
+      "{ href, /search?q=x&copy=1&lang=en&p=2/3 }"
+    );
+
     EXPECT_LINKS(
       R"(
 <html>
@@ -691,6 +1015,18 @@ TEST(tools, getLinks)
 }
 #undef EXPECT_LINKS
 
+TEST(tools, urlEncode)
+{
+    EXPECT_EQ(urlEncode("", true), "");
+    EXPECT_EQ(urlEncode("A/b-c_d.e!f~g*h'i(j)k/0123456789", true), "A/b-c_d.e!f~g*h'i(j)k/0123456789");
+    EXPECT_EQ(urlEncode("a b", false), "a%20b");
+    EXPECT_EQ(urlEncode("a%b", false), "a%25b");
+    EXPECT_EQ(urlEncode("?q=a+b;c,d:e@f&g$", false), "?q=a+b;c,d:e@f&g$");
+    EXPECT_EQ(urlEncode("?q=a+b;c,d:e@f&g$", true), "%3Fq%3Da%2Bb%3Bc%2Cd%3Ae%40f%26g%24");
+    EXPECT_EQ(urlEncode(std::string("\x00\x01\x0f\x7f\xff", 5), true), "%00%01%0F%7F%FF");
+    EXPECT_EQ(urlEncode(u8"Κ", false), "%CE%9A");
+}
+
 TEST(tools, httpRedirectHtml)
 {
     EXPECT_EQ(
@@ -768,4 +1104,91 @@ TEST(CommonTools, getTextLength)
 
   // Mixed: "café में" = 6 graphemes
   EXPECT_EQ(getTextLength("café में"), 6u);
+
+  // CR LF is a single grapheme, other control characters aren't combined
+  EXPECT_EQ(getTextLength("a\r\nb"), 3u);
+  EXPECT_EQ(getTextLength("a\n\rb"), 4u);
+  EXPECT_EQ(getTextLength("\r\r\n\n"), 3u);
+  EXPECT_EQ(getTextLength("\t\x01\x7f"), 3u);
+  EXPECT_EQ(getTextLength("\r\nमें\r\n"), 3u);
+
+  // Long texts (past the vectorized ASCII scan)
+  EXPECT_EQ(getTextLength(std::string(100, 'a')), 100u);
+  EXPECT_EQ(getTextLength(std::string(100, 'a') + "में"), 101u);
+}
+
+TEST(CommonTools, getTextLengths)
+{
+  EXPECT_EQ(getTextLengths({}), std::vector<size_t>());
+  EXPECT_EQ(getTextLengths({"", "hello", "café में", "\U0001F44B\U0001F3FD", "a\r\nb"}),
+            std::vector<size_t>({0, 5, 6, 1, 3}));
+}
+
+TEST(CommonTools, findInvalidUtf8)
+{
+  EXPECT_EQ(findInvalidUtf8(""), 0u);
+  EXPECT_EQ(findInvalidUtf8("abc"), 3u);
+  EXPECT_EQ(findInvalidUtf8("café में \U0001F44B"), 20u);
+
+  // Long enough for the vectorised scan of ASCII characters
+  const std::string ascii = "0123456789abcdefghijklmnopqrstuvwxyz";
+  EXPECT_EQ(findInvalidUtf8(ascii), 36u);
+  EXPECT_EQ(findInvalidUtf8(ascii + "\xff" + ascii), 36u);
+  EXPECT_EQ(findInvalidUtf8(ascii + "é" + ascii + "\x80"), 74u);
+
+  // Stray continuation byte and invalid lead bytes
+  EXPECT_EQ(findInvalidUtf8("a\x80"), 1u);
+  EXPECT_EQ(findInvalidUtf8("a\xc1\xbf"), 1u);
+  EXPECT_EQ(findInvalidUtf8("a\xf5\x80\x80\x80"), 1u);
+
+  // Overlong encodings
+  EXPECT_EQ(findInvalidUtf8("\xc0\xaf"), 0u);
+  EXPECT_EQ(findInvalidUtf8("\xe0\x80\xaf"), 0u);
+  EXPECT_EQ(findInvalidUtf8("\xf0\x80\x80\xaf"), 0u);
+
+  // Surrogates and code points above U+10FFFF
+  EXPECT_EQ(findInvalidUtf8("\xed\xa0\x80"), 0u);
+  EXPECT_EQ(findInvalidUtf8("\xed\x9f\xbf"), 3u);
+  EXPECT_EQ(findInvalidUtf8("\xf4\x90\x80\x80"), 0u);
+  EXPECT_EQ(findInvalidUtf8("\xf4\x8f\xbf\xbf"), 4u);
+
+  // Truncated sequences
+  EXPECT_EQ(findInvalidUtf8("ab\xe2\x82"), 2u);
+  EXPECT_EQ(findInvalidUtf8("ab\xe2\x82x"), 2u);
+  EXPECT_EQ(findInvalidUtf8("ab\xf0\x9f\x91"), 2u);
+
+  // Search from an offset
+  EXPECT_EQ(findInvalidUtf8("\xff\xff" "abc\xff", 0), 0u);
+  EXPECT_EQ(findInvalidUtf8("\xff\xff" "abc\xff", 1), 1u);
+  EXPECT_EQ(findInvalidUtf8("\xff\xff" "abc\xff", 2), 5u);
+  EXPECT_EQ(findInvalidUtf8("abc", 10), 3u);
+}
+
+TEST(CommonTools, getInvalidUtf8Length)
+{
+  // Bytes which can't start a sequence
+  EXPECT_EQ(getInvalidUtf8Length("\x80\x80", 0), 1u);
+  EXPECT_EQ(getInvalidUtf8Length("\xff", 0), 1u);
+  EXPECT_EQ(getInvalidUtf8Length("\xc0\xaf", 0), 1u);
+
+  // Truncated sequences are a single invalid sequence
+  EXPECT_EQ(getInvalidUtf8Length("ab\xe2\x82", 2), 2u);
+  EXPECT_EQ(getInvalidUtf8Length("ab\xe2\x82x", 2), 2u);
+  EXPECT_EQ(getInvalidUtf8Length("ab\xf0\x9f\x91", 2), 3u);
+  EXPECT_EQ(getInvalidUtf8Length("ab\xf0\x9f\x91x\xf0\x9f", 2), 3u);
+  EXPECT_EQ(getInvalidUtf8Length("\xf0\x9f", 0), 2u);
+
+  // ... but not the bytes after an invalid second byte
+  EXPECT_EQ(getInvalidUtf8Length("\xe0\x80\xaf", 0), 1u);
+  EXPECT_EQ(getInvalidUtf8Length("\xed\xa0\x80", 0), 1u);
+  EXPECT_EQ(getInvalidUtf8Length("\xf4\x90\x80\x80", 0), 1u);
+
+  // Every invalid sequence of a text is found once
+  const std::string text = "a\xf0\x9f\x91" "b\xe2\x82" "c\xed\xa0\x80";
+  std::vector<size_t> offsets;
+  for ( size_t offset = findInvalidUtf8(text); offset < text.size();
+        offset = findInvalidUtf8(text, offset + getInvalidUtf8Length(text, offset)) ) {
+    offsets.push_back(offset);
+  }
+  EXPECT_EQ(offsets, std::vector<size_t>({1, 5, 8, 9, 10}));
 }
@@ -1,4 +1,6 @@
 #include <sstream>
+#include <fstream>
+#include <cstdio>
 
 #include "gtest/gtest.h"
 
@@ -37,6 +39,46 @@ TEST(zimfilechecks, test_metadata)
     ASSERT_TRUE(logger.overallStatus());
 }
 
+TEST(zimfilechecks, test_metadata_counter)
+{
+    // The Counter metadata of good.zim matches its items
+    zim::Archive archive("data/zimfiles/good.zim");
+    ErrorLogger logger;
+
+    test_metadata(archive, logger, 3);
+
+    ASSERT_TRUE(logger.overallStatus());
+
+    const std::map<std::string, size_t> expectedCounts{
+      {"image/png", 1},
+      {"text/html", 3}
+    };
+    // Only the items of the C namespace are counted
+    EXPECT_EQ(countItemsByMimeType(archive, false, 3), expectedCounts);
+    EXPECT_EQ(countItemsByMimeType(archive, true, 3), expectedCounts);
+}
+
+TEST(zimfilechecks, test_metadata_counter_old_namespace_scheme)
+{
+    zim::Archive archive("data/zimfiles/wikibooks_be_all_nopic_2017-02.zim");
+    ErrorLogger logger;
+
+    // Its Counter counts the metadata too
+    test_metadata(archive, logger, 3);
+    ASSERT_TRUE(logger.overallStatus());
+
+    std::map<std::string, size_t> expectedCounts{
+      {"application/javascript", 3},
+      {"image/gif", 2},
+      {"image/png", 32},
+      {"text/css", 1},
+      {"text/html", 66}
+    };
+    EXPECT_EQ(countItemsByMimeType(archive, false, 3), expectedCounts);
+    expectedCounts["text/plain"] = 9;
+    EXPECT_EQ(countItemsByMimeType(archive, true, 3), expectedCounts);
+}
+
 TEST(zimfilechecks, test_favicon)
 {
     std::string fn = "data/zimfiles/wikibooks_be_all_nopic_2017-02.zim";
@@ -76,6 +118,41 @@ TEST(zimfilechecks, test_articles)
     ASSERT_TRUE(logger.overallStatus());
 }
 
+TEST(zimfilechecks, test_articles_cost_report)
+{
+    std::string fn = "data/zimfiles/wikibooks_be_all_nopic_2017-02.zim";
+
+    zim::Archive archive(fn);
+    ErrorLogger logger;
+    ProgressBar progress(1);
+    ZimCheckOptions options;
+    options.enabledTests.enableAll();
+
+    {
+      const auto report = test_articles(archive, logger, progress, options);
+      ASSERT_TRUE(report.slowestEntries.empty());
+      ASSERT_TRUE(report.slowestClusters.empty());
+    }
+
+    options.slowestCount = 5;
+    const auto report = test_articles(archive, logger, progress, options, 2);
+    ASSERT_TRUE(logger.overallStatus());
+
+    ASSERT_EQ(report.slowestEntries.size(), 5u);
+    for (size_t i = 1; i < report.slowestEntries.size(); ++i) {
+      EXPECT_GE(report.slowestEntries[i-1].checkTime, report.slowestEntries[i].checkTime);
+    }
+    for (const auto& e : report.slowestEntries) {
+      EXPECT_TRUE(archive.hasEntryByPath(e.path)) << e.path;
+      EXPECT_GE(e.checkTime, e.dataTime) << e.path;
+    }
+
+    // wikibooks_be_all_nopic_2017-02.zim contains 2 clusters
+    ASSERT_EQ(report.slowestClusters.size(), 2u);
+    EXPECT_GE(report.slowestClusters[0].checkTime, report.slowestClusters[1].checkTime);
+    EXPECT_NE(report.slowestClusters[0].cluster, report.slowestClusters[1].cluster);
+}
+
 TEST(zimfilechecks, test_redirect_loop_pass)
 {
   std::string fn = "data/zimfiles/wikibooks_be_all_nopic_2017-02.zim";
@@ -97,6 +174,67 @@ TEST(zimfilechecks, test_redirect_loop_fail)
   ASSERT_FALSE(logger.overallStatus());
 }
 
+TEST(zimfilechecks, test_redirect_chains)
+{
+  const std::string redirectMapPath = "zimcheck-test-redirects.tsv";
+  zim::Archive archive("data/zimfiles/wikibooks_be_all_nopic_2017-02.zim");
+  ZimCheckOptions options;
+  options.enabledTests.enable(TestType::REDIRECT_CHAIN);
+  options.maxRedirectDepth = 0;
+  options.redirectMapPath = redirectMapPath;
+
+  ErrorLogger logger;
+  const auto report = test_redirect_loop(archive, logger, options);
+  // Redirect chains are only warnings
+  ASSERT_TRUE(logger.overallStatus());
+
+  // All the redirects of wikibooks_be_all_nopic_2017-02.zim point to items
+  ASSERT_EQ(report.depthHistogram, std::vector<size_t>({0, 5}));
+
+  std::ifstream redirectMap(redirectMapPath);
+  std::vector<std::string> lines;
+  for ( std::string line; std::getline(redirectMap, line); )
+    lines.push_back(line);
+  std::remove(redirectMapPath.c_str());
+
+  // The redirect of the favicon (outside the content) is left out
+  ASSERT_EQ(lines.size(), 4u);
+  EXPECT_EQ(lines[0], "Main_Page.html\tMain Page\tПершая_старонка.html");
+  // The map can be read back as a redirects file
+  for ( const auto& line : lines ) {
+    const auto tab1 = line.find('\t');
+    const auto tab2 = line.find('\t', tab1 + 1);
+    ASSERT_NE(tab2, std::string::npos) << line;
+    EXPECT_LT(tab1 + 1, tab2) << line;
+  }
+}
+
+TEST(zimfilechecks, test_clusters)
+{
+  ErrorLogger logger;
+  zim::Archive archive("data/zimfiles/good.zim");
+  const auto report = test_clusters(archive, "data/zimfiles/good.zim", logger, 2);
+  ASSERT_TRUE(logger.overallStatus());
+
+  // good.zim contains a zstd compressed cluster with the text items and an
+  // uncompressed cluster with the images and the title indexes
+  ASSERT_EQ(report.compressionStats.size(), 2u);
+  const auto& uncompressed = report.compressionStats[0];
+  EXPECT_EQ(uncompressed.compression, "none");
+  EXPECT_EQ(uncompressed.clusterCount, 1u);
+  EXPECT_EQ(uncompressed.blobCount, 5u);
+  EXPECT_EQ(uncompressed.storedSize, 43127u);
+  EXPECT_EQ(uncompressed.dataSize, 10246u); // favicon & illustration
+
+  const auto& zstd = report.compressionStats[1];
+  EXPECT_EQ(zstd.compression, "zstd");
+  EXPECT_EQ(zstd.clusterCount, 1u);
+  EXPECT_EQ(zstd.blobCount, 13u);
+  EXPECT_EQ(zstd.storedSize, 623u);
+  EXPECT_EQ(zstd.dataSize, 1567u);
+  EXPECT_EQ(report.unknownSizeClusterCount, 0u);
+}
+
 class CapturedStdStream
 {
   std::ostream& stream;
@@ -130,6 +268,26 @@ struct CapturedStderr : CapturedStdStream
   CapturedStderr() : CapturedStdStream(std::cerr) {}
 };
 
+TEST(zimfilechecks, test_clusters_unreadable_headers)
+{
+  ErrorLogger logger;
+  zim::Archive archive("data/zimfiles/good.zim");
+  CapturedStdout zimcheckOutput;
+  const auto report = test_clusters(archive, "data/zimfiles/no-such-file.zim", logger, 2);
+
+  // libzim tells which clusters are compressed, but their stored size is
+  // unknown, which is reported
+  EXPECT_EQ(report.unknownSizeClusterCount, 2u);
+  ASSERT_EQ(report.compressionStats.size(), 2u);
+  EXPECT_EQ(report.compressionStats[0].compression, "compressed");
+  EXPECT_EQ(report.compressionStats[0].storedSize, 0u);
+  EXPECT_EQ(report.compressionStats[0].dataSize, 1567u);
+  EXPECT_EQ(report.compressionStats[1].compression, "none");
+  EXPECT_NE(std::string(zimcheckOutput).find(
+    "[WARNING] Cluster Layout: The stored size of 2 cluster(s) is unknown "
+    "(unable to read data/zimfiles/no-such-file.zim)"), std::string::npos);
+}
+
 int zimcheck (const std::vector<const char*>& args);
 
 const std::string zimcheck_help_message(
@@ -155,7 +313,13 @@ Options:
  -H --help            Displays Help
  -V --version         Displays software version
  -L --redirect_loop   Checks for the existence of redirect loops
+ -T --utf8            UTF-8 validity of titles and text items
+ -K --clusters        Cluster layout analysis (not included in --all)
+ -D --redirect_chain  Redirect chains longer than --redirect_depth (with -L, not included in --all)
  -W=<nb_thread> --threads=<nb_thread>  count of threads to utilize [default: 1]
+ -S=<count> --slowest=<count>  report the <count> most expensive entries and clusters [default: 0]
+ --redirect_depth=<depth>  maximal redirect chain length accepted by -D [default: 5]
+ --redirect_map=<file>  write the flattened redirect mapping to <file> (with -L)
 
 Examples:
  zimcheck -A wikipedia.zim
@@ -410,6 +574,26 @@ TEST(zimcheck, redirect_loop_goodzimfile)
   );
 }
 
+TEST(zimcheck, utf8_goodzimfile)
+{
+  const std::string expected_output(
+    "[INFO] Checking zim file data/zimfiles/good.zim" "\n"
+    "[INFO] Zimcheck version is " VERSION "\n"
+    "[WARNING] Integrity check is skipped. Any detected errors may in fact be due to corrupted/invalid data.\n"
+    "[INFO] Verifying Articles' content..." "\n"
+    "[INFO] Overall Test Status: Pass" "\n"
+    "[INFO] Total time taken by zimcheck: <3 seconds." "\n"
+  );
+
+  test_zimcheck_single_option(
+    {"-T", "--utf8"},
+    GOOD_ZIMFILE,
+    0,
+    expected_output,
+    EMPTY_STDERR
+  );
+}
+
 const std::string ALL_CHECKS_OUTPUT_ON_GOODZIMFILE(
       "[INFO] Checking zim file data/zimfiles/good.zim" "\n"
       "[INFO] Zimcheck version is " VERSION "\n"
@@ -467,6 +651,28 @@ TEST(zimcheck, invalid_long_option)
     }
 }
 
+TEST(zimcheck, negative_slowest)
+{
+    {
+      CapturedStdout zimcheck_output;
+      CapturedStderr zimcheck_stderr;
+      ASSERT_EQ(1, zimcheck({"zimcheck", "--slowest=-1", GOOD_ZIMFILE}));
+      ASSERT_EQ("--slowest must not be negative\n", std::string(zimcheck_stderr));
+      ASSERT_EQ(zimcheck_help_message, std::string(zimcheck_output));
+    }
+}
+
+TEST(zimcheck, negative_redirect_depth)
+{
+    {
+      CapturedStdout zimcheck_output;
+      CapturedStderr zimcheck_stderr;
+      ASSERT_EQ(1, zimcheck({"zimcheck", "-L", "--redirect_depth=-1", GOOD_ZIMFILE}));
+      ASSERT_EQ("--redirect_depth must not be negative\n", std::string(zimcheck_stderr));
+      ASSERT_EQ(zimcheck_help_message, std::string(zimcheck_output));
+    }
+}
+
 TEST(zimcheck, json_goodzimfile)
 {
     CapturedStdout zimcheck_output;
@@ -490,7 +696,8 @@ TEST(zimcheck, json_goodzimfile)
       "    \"url_internal\","                                       "\n"
       "    \"url_external\","                                       "\n"
       "    \"url_empty\","                                          "\n"
-      "    \"redirect\""                                            "\n"
+      "    \"redirect\","                                           "\n"
+      "    \"utf8\""                                                "\n"
       "  ],"                                                        "\n"
       "  \"file_name\" : \"data/zimfiles/good.zim\","               "\n"
       "  \"file_uuid\" : \"00000000-0000-0000-0000-000000000000\"," "\n"
@@ -935,7 +1142,8 @@ TEST(zimcheck, json_poorzimfile)
       "    \"url_internal\","                                               "\n"
       "    \"url_external\","                                               "\n"
       "    \"url_empty\","                                                  "\n"
-      "    \"redirect\""                                                    "\n"
+      "    \"redirect\","                                                   "\n"
+      "    \"utf8\""                                                        "\n"
       "  ],"                                                                "\n"
       "  \"file_name\" : \"data/zimfiles/poor.zim\","                       "\n"
       "  \"file_uuid\" : \"00000000-0000-0000-0000-000000000000\","         "\n"
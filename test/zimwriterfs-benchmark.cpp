@@ -0,0 +1,131 @@
+// Compares the extraction of the head information of HTML pages by
+// scanHtmlHead() with the full Gumbo parse that it replaces.
+//
+// Usage: zimwriterfs-benchmark [HTML_DIRECTORY]
+//
+// The HTML files of HTML_DIRECTORY (e.g. the output of a scraper) are used
+// if it is given, otherwise a synthetic article page.
+
+#include "../src/zimwriterfs/dircrawler.h"
+#include "../src/zimwriterfs/tools.h"
+#include "../src/tools.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// stub from zimwriterfs.cpp
+bool inflateHtmlFlag = false;
+
+namespace
+{
+
+typedef std::chrono::steady_clock Clock;
+
+// Accumulates the results of the benchmarked functions so that the compiler
+// cannot optimize their calls away
+volatile size_t sink = 0;
+
+// Calls f on every page repeatedly for about the given time and prints the
+// average time per page
+template<class F>
+void benchmark(const std::string& name, const std::vector<std::string>& pages, F f,
+               std::chrono::milliseconds duration = std::chrono::milliseconds(1000))
+{
+  size_t calls = 0;
+  size_t result = 0;
+  const auto start = Clock::now();
+  do {
+    for (const auto& page : pages) {
+      result += f(page);
+    }
+    calls += pages.size();
+  } while (Clock::now() - start < duration);
+
+  const std::chrono::duration<double, std::micro> elapsed(Clock::now() - start);
+  sink = sink + result;
+  std::cout << std::left << std::setw(32) << name
+            << std::right << std::fixed << std::setprecision(1)
+            << std::setw(10) << elapsed.count() / calls << " us/page" << std::endl;
+}
+
+size_t gumboHead(const std::string& page)
+{
+  HtmlHead head;
+  GumboOutput* output = gumbo_parse(page.c_str());
+  const GumboVector* children = &output->root->v.element.children;
+  for (unsigned int i = 0; i < children->length; ++i) {
+    GumboNode* child = (GumboNode*)(children->data[i]);
+    if (child->type == GUMBO_NODE_ELEMENT && child->v.element.tag == GUMBO_TAG_HEAD) {
+      readHtmlHead(&child->v.element.children, head);
+    }
+  }
+  gumbo_destroy_output(&kGumboDefaultOptions, output);
+  return head.title.size() + head.refreshValues.size();
+}
+
+size_t scannedHead(const std::string& page)
+{
+  HtmlHead head;
+  if ( !scanHtmlHead(page, head) )
+    return gumboHead(page);
+  return head.title.size() + head.refreshValues.size();
+}
+
+// A 200 KB page looking like a Wikipedia article
+std::string makeArticlePage()
+{
+  std::string html = "<!DOCTYPE html>\n<html lang=\"en\" dir=\"ltr\">\n<head>\n"
+                     "<meta charset=\"UTF-8\">\n<title>Eiffel Tower</title>\n"
+                     "<link rel=\"stylesheet\" href=\"../-/s/style.css\">\n"
+                     "<script src=\"../-/j/head.js\"></script>\n</head>\n<body>\n";
+  while (html.size() < 200*1024) {
+    html += "<p>The <b>Eiffel Tower</b> is a <a href=\"Wrought_iron\">wrought-iron</a> "
+            "lattice tower on the <a href=\"Champ_de_Mars\">Champ de Mars</a> in "
+            "<a href=\"Paris\">Paris</a>, France.<sup><a href=\"#cite_note-1\">[1]</a></sup></p>\n";
+  }
+  return html + "</body>\n</html>\n";
+}
+
+std::vector<std::string> readHtmlFiles(const std::string& directory)
+{
+  std::vector<std::string> pages;
+  DirectoryCrawler crawler(directory, 4);
+  DirectoryCrawler::Entry entry;
+  while (crawler.next(entry)) {
+    const auto extension = getFileExtension(entry.path);
+    if ( entry.type == DirectoryCrawler::Entry::Type::FILE
+         && (extension == "html" || extension == "htm") ) {
+      pages.push_back(getFileContent(directory + "/" + entry.path));
+    }
+  }
+  return pages;
+}
+
+} // unnamed namespace
+
+int main(int argc, char** argv)
+{
+  const auto pages = argc > 1 ? readHtmlFiles(argv[1])
+                              : std::vector<std::string>{ makeArticlePage() };
+  if ( pages.empty() ) {
+    std::cerr << "No HTML files found" << std::endl;
+    return 1;
+  }
+
+  size_t totalSize = 0, gumboFallbacks = 0;
+  for (const auto& page : pages) {
+    HtmlHead head;
+    totalSize += page.size();
+    gumboFallbacks += !scanHtmlHead(page, head);
+  }
+  std::cout << pages.size() << " pages of " << totalSize / pages.size()
+            << " bytes on average, " << gumboFallbacks
+            << " of them need Gumbo" << std::endl;
+
+  benchmark("gumbo_parse + readHtmlHead", pages, gumboHead);
+  benchmark("scanHtmlHead", pages, scannedHead);
+  return 0;
+}
@@ -15,15 +15,27 @@
  *
  */
 
+// For the cluster and blob of the items
+#define ZIM_PRIVATE
 #include <unistd.h>
+#include <sys/stat.h>
+#include <ftw.h>
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
-#include <magic.h>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <zlib.h>
 
 #include <zim/archive.h>
 
 #include "gtest/gtest.h"
 
 #include "../src/zimwriterfs/zimcreatorfs.h"
+#include "../src/zimwriterfs/dircrawler.h"
+#include "../src/zimwriterfs/workerpool.h"
 #include "../src/zimwriterfs/tools.h"
 #include "../src/tools.h"
 
@@ -31,24 +43,6 @@
 // stub from zimwriterfs.cpp
 bool inflateHtmlFlag = false;
 bool isVerbose() { return false; }
-magic_t magic;
-
-class LibMagicInit
-{
-public:
-  LibMagicInit()
-  {
-    if (! done) {
-      magic = magic_open(MAGIC_MIME);
-      magic_load(magic, NULL);
-      done = true;
-    }
-  }
-private:
-  static bool done;
-};
-
-bool LibMagicInit::done = false;
 
 
 class TempFile
@@ -64,8 +58,6 @@ private:
 
 TEST(ZimCreatorFSTest, MinimalZim)
 {
-  LibMagicInit libmagic;
-
   std::string directoryPath = "data/minimal-content";
   ZimCreatorFS zimCreator(directoryPath);
   zimCreator.setMainPath("index.html");
@@ -92,8 +84,6 @@ TEST(ZimCreatorFSTest, MinimalZim)
 
 TEST(ZimCreatorFSTest, SymlinkShouldCreateRedirectEntry)
 {
-  LibMagicInit libmagic;
-
   std::string directoryPath = "data/with-symlink";
   ZimCreatorFS zimCreator(directoryPath);
   zimCreator.setMainPath("hello.html");
@@ -129,10 +119,307 @@ TEST(ZimCreatorFSTest, ThrowsErrorIfDirectoryNotExist)
   }, std::invalid_argument );
 }
 
+class TempDirectoryTree
+{
+public:
+  explicit TempDirectoryTree(const std::vector<std::string>& files)
+  {
+    char tmpl[] = "/tmp/zimwriterfs-test-XXXXXX";
+    _root = mkdtemp(tmpl);
+    for (const auto& f : files) {
+      for (auto pos = f.find('/'); pos != std::string::npos; pos = f.find('/', pos + 1)) {
+        mkdir((_root + "/" + f.substr(0, pos)).c_str(), 0700);
+      }
+      std::ofstream(_root + "/" + f) << f;
+    }
+  }
+  ~TempDirectoryTree()
+  {
+    nftw(_root.c_str(),
+         [](const char* path, const struct stat*, int, struct FTW*) { return remove(path); },
+         16, FTW_DEPTH | FTW_PHYS);
+  }
+  const std::string& root() const { return _root; }
+private:
+  std::string _root;
+};
+
+std::vector<std::string> crawl(const std::string& root, unsigned threadCount, size_t queueCapacity)
+{
+  std::vector<std::string> found;
+  DirectoryCrawler crawler(root, threadCount, queueCapacity);
+  DirectoryCrawler::Entry entry;
+  while (crawler.next(entry)) {
+    const char* const types = "DFLUSE";
+    found.push_back(types[int(entry.type)] + (" " + entry.path));
+  }
+  return found;
+}
+
+TEST(DirectoryCrawlerTest, CrawlsTheWholeTree)
+{
+  const std::vector<std::string> files = {
+    "index.html",
+    "a/1.html", "a/2.html", "a/b/c/d/deep.html",
+    "e/1.css", "e/f/1.js", "e/g/1.png", "e/g/2.png",
+    "h/i/j/k/l/m/n/o/p/1.txt",
+  };
+  TempDirectoryTree tree(files);
+  ASSERT_EQ(symlink("index.html", (tree.root() + "/a/link.html").c_str()), 0);
+  ASSERT_EQ(mkdir((tree.root() + "/empty").c_str(), 0700), 0);
+
+  // Sorted per directory, each subtree at the place of its directory
+  const std::vector<std::string> expected = {
+    "D ",
+    "D a", "F a/1.html", "F a/2.html",
+    "D a/b", "D a/b/c", "D a/b/c/d", "F a/b/c/d/deep.html",
+    "L a/link.html",
+    "D e", "F e/1.css", "D e/f", "F e/f/1.js",
+    "D e/g", "F e/g/1.png", "F e/g/2.png",
+    "D empty",
+    "D h", "D h/i", "D h/i/j", "D h/i/j/k", "D h/i/j/k/l",
+    "D h/i/j/k/l/m", "D h/i/j/k/l/m/n", "D h/i/j/k/l/m/n/o",
+    "D h/i/j/k/l/m/n/o/p", "F h/i/j/k/l/m/n/o/p/1.txt",
+    "F index.html",
+  };
+
+  for (unsigned threadCount : {1, 2, 8}) {
+    for (size_t queueCapacity : {1, 1000}) {
+      EXPECT_EQ(crawl(tree.root(), threadCount, queueCapacity), expected)
+        << threadCount << " threads, queue of " << queueCapacity;
+    }
+  }
+}
+
+TEST(DirectoryCrawlerTest, OrderDoesntDependOnTheThreads)
+{
+  std::vector<std::string> files;
+  for (int i = 0; i < 300; ++i) {
+    files.push_back("d" + std::to_string(i % 7) + "/s" + std::to_string(i % 5)
+                    + "/t" + std::to_string(i % 3) + "/f" + std::to_string(i));
+    files.push_back("d" + std::to_string(i % 11) + "/g" + std::to_string(i));
+  }
+  TempDirectoryTree tree(files);
+
+  const auto expected = crawl(tree.root(), 1, 4096);
+  ASSERT_EQ(expected.size(), 1u + 11 + 7 * 5 + 7 * 5 * 3 + 600);
+  for (int run = 0; run < 5; ++run) {
+    for (size_t queueCapacity : {1, 16, 4096}) {
+      EXPECT_EQ(crawl(tree.root(), 8, queueCapacity), expected)
+        << "queue of " << queueCapacity;
+    }
+  }
+}
+
+TEST(DirectoryCrawlerTest, ReportsUnreadableRoot)
+{
+  DirectoryCrawler crawler("Non-existing-dir", 2);
+  DirectoryCrawler::Entry entry;
+  ASSERT_TRUE(crawler.next(entry));
+  EXPECT_EQ(entry.type, DirectoryCrawler::Entry::Type::DIRECTORY_ERROR);
+  EXPECT_EQ(entry.path, "");
+  EXPECT_FALSE(crawler.next(entry));
+}
+
+TEST(DirectoryCrawlerTest, CanBeStoppedEarly)
+{
+  std::vector<std::string> files;
+  for (int i = 0; i < 100; ++i) {
+    files.push_back("dir" + std::to_string(i % 10) + "/file" + std::to_string(i));
+  }
+  TempDirectoryTree tree(files);
+
+  DirectoryCrawler crawler(tree.root(), 4, 2);
+  DirectoryCrawler::Entry entry;
+  ASSERT_TRUE(crawler.next(entry));
+  crawler.stop();
+  size_t remaining = 0;
+  while (crawler.next(entry)) {
+    ++remaining;
+  }
+  EXPECT_LE(remaining, 2u);
+}
+
+TEST(WorkerPoolTest, ResultsAreDeliveredThroughFutures)
+{
+  std::vector<std::future<int>> results;
+  {
+    WorkerPool pool(4, 8);
+    for (int i = 0; i < 100; ++i) {
+      results.push_back(pool.submit([i]() {
+        if ( i == 42 )
+          throw std::runtime_error("42");
+        return i * i;
+      }));
+    }
+  }
+
+  for (int i = 0; i < 100; ++i) {
+    if ( i == 42 ) {
+      EXPECT_THROW(results[i].get(), std::runtime_error);
+    } else {
+      EXPECT_EQ(results[i].get(), i * i);
+    }
+  }
+}
+
 bool operator==(const Redirect& a, const Redirect& b) {
   return a.path == b.path && a.title == b.title && a.target == b.target;
 }
 
+TEST(ZimCreatorFSTest, DeduplicatesIdenticalFiles)
+{
+  // Incompressible content
+  std::string data(1024*1024, '\0');
+  std::mt19937 random(42);
+  std::generate(data.begin(), data.end(), [&]() { return char(random()); });
+
+  TempDirectoryTree tree({"a.bin", "dir/b.bin", "style.css", "style.txt"});
+  std::ofstream(tree.root() + "/a.bin") << data;
+  std::ofstream(tree.root() + "/dir/b.bin") << data;
+  std::ofstream(tree.root() + "/style.css") << "body {}";
+  std::ofstream(tree.root() + "/style.txt") << "body {}";
+
+  TempFile out("dedup.zim");
+  {
+    ZimCreatorFS zimCreator(tree.root());
+    zimCreator.setDeduplication(true);
+    zimCreator.startZimCreation(out.path());
+    zimCreator.visitDirectory(tree.root());
+    zimCreator.finishZimCreation();
+  }
+
+  zim::Archive archive(out.path());
+  EXPECT_LT(archive.getFilesize(), data.size() * 3 / 2);
+  for (const auto path : {"a.bin", "dir/b.bin"}) {
+    auto entry = archive.getEntryByPath(path);
+    EXPECT_FALSE(entry.isRedirect());
+    EXPECT_EQ(std::string(entry.getItem().getData()), data);
+  }
+
+  // Same content, different mimetypes
+  EXPECT_EQ(archive.getEntryByPath("style.css").getItem().getMimetype(), "text/css");
+  EXPECT_EQ(archive.getEntryByPath("style.txt").getItem().getMimetype(), "text/plain");
+}
+
+// The entries of an archive, with the place of the content of the items
+std::vector<std::string> describeArchive(const std::string& path)
+{
+  std::vector<std::string> entries;
+  zim::Archive archive(path);
+  for (const auto& entry : archive.iterByPath()) {
+    std::string description = entry.getPath() + " [" + entry.getTitle() + "] ";
+    if (entry.isRedirect()) {
+      description += "-> " + entry.getRedirectEntry().getPath();
+    } else {
+      const auto item = entry.getItem();
+      description += item.getMimetype()
+                   + " cluster " + std::to_string(item.getClusterIndex())
+                   + " blob " + std::to_string(item.getBlobIndex());
+    }
+    entries.push_back(description);
+  }
+  return entries;
+}
+
+TEST(ZimCreatorFSTest, AddsTheItemsInADeterministicOrder)
+{
+  std::vector<std::string> files;
+  for (int i = 0; i < 60; ++i) {
+    const std::string dir = "dir" + std::to_string(i % 6) + "/sub" + std::to_string(i % 4);
+    files.push_back(dir + "/page" + std::to_string(i) + ".html");
+    files.push_back(dir + "/style" + std::to_string(i) + ".css");
+    files.push_back(dir + "/data" + std::to_string(i) + ".bin");
+  }
+  TempDirectoryTree tree(files);
+  for (int i = 0; i < 60; ++i) {
+    const std::string dir = tree.root() + "/dir" + std::to_string(i % 6) + "/sub" + std::to_string(i % 4);
+    std::ofstream(dir + "/page" + std::to_string(i) + ".html")
+      << "<html><head><title>Page " << i << "</title></head></html>";
+    std::ofstream(dir + "/style" + std::to_string(i) + ".css") << "body {}";
+    std::ofstream(dir + "/data" + std::to_string(i) + ".bin") << "data " << i % 10;
+  }
+
+  const auto build = [&tree](unsigned threadCount) {
+    TempFile out("deterministic.zim");
+    {
+      ZimCreatorFS zimCreator(tree.root());
+      zimCreator.setCrawlerThreadCount(threadCount);
+      zimCreator.setHtmlWorkerCount(threadCount);
+      zimCreator.setDeduplication(true);
+      zimCreator.startZimCreation(out.path());
+      zimCreator.visitDirectory(tree.root());
+      zimCreator.finishZimCreation();
+    }
+    return describeArchive(out.path());
+  };
+
+  const auto expected = build(1);
+  EXPECT_EQ(expected.size(), files.size());
+  for (int run = 0; run < 2; ++run) {
+    EXPECT_EQ(build(8), expected);
+  }
+}
+
+TEST(ZimCreatorFSTest, ChecksRedirectTargets)
+{
+  TempDirectoryTree tree({"page.html", "redirect.html", "redirects.tsv"});
+  std::ofstream(tree.root() + "/redirect.html")
+    << "<html><head><meta http-equiv=\"refresh\" content=\"0;url=page.html\"></head></html>";
+  std::ofstream(tree.root() + "/redirects.tsv")
+    << "tsv-redirect\tTitle\tredirect.html\n"
+    << "chained-redirect\tTitle\tlater-redirect\n"
+    << "later-redirect\tTitle\tpage.html\n"
+    << "dangling-redirect\tTitle\tmissing.html\n";
+
+  {
+    ZimCreatorFS zimCreator(tree.root());
+    TempFile out("redirects.zim");
+    zimCreator.startZimCreation(out.path());
+    zimCreator.visitDirectory(tree.root());
+    zimCreator.add_redirectArticles_from_file(tree.root() + "/redirects.tsv");
+    // The dangling redirect of the TSV file is only reported
+    EXPECT_NO_THROW(zimCreator.checkRedirectTargets());
+  }
+
+  std::ofstream(tree.root() + "/dangling.html")
+    << "<html><head><meta http-equiv=\"refresh\" content=\"0;url=missing.html\"></head></html>";
+  {
+    ZimCreatorFS zimCreator(tree.root());
+    TempFile out("dangling-redirect.zim");
+    zimCreator.startZimCreation(out.path());
+    zimCreator.visitDirectory(tree.root());
+    EXPECT_THROW(zimCreator.checkRedirectTargets(), std::runtime_error);
+  }
+}
+
+TEST(ZimCreatorFSTest, ReadsTheRedirectsFromAPipe)
+{
+  TempDirectoryTree tree({"page.html"});
+  TempFile out("fifo-redirects.zim");
+  {
+    ZimCreatorFS zimCreator(tree.root());
+    zimCreator.startZimCreation(out.path());
+    zimCreator.visitDirectory(tree.root());
+
+    // Like `-r <(command)`
+    const std::string fifoPath = tree.root() + "/redirects.fifo";
+    ASSERT_EQ(mkfifo(fifoPath.c_str(), 0600), 0);
+    std::thread writer([&fifoPath]() {
+      std::ofstream(fifoPath) << "redirect\tTitle\tpage.html\n";
+    });
+    zimCreator.add_redirectArticles_from_file(fifoPath);
+    writer.join();
+    zimCreator.finishZimCreation();
+  }
+
+  zim::Archive archive(out.path());
+  const auto redirect = archive.getEntryByPath("redirect");
+  ASSERT_TRUE(redirect.isRedirect());
+  EXPECT_EQ(redirect.getTitle(), "Title");
+  EXPECT_EQ(redirect.getRedirectEntry().getPath(), "page.html");
+}
+
 TEST(ZimCreatorFSTest, ParseRedirect)
 {
   {
@@ -180,6 +467,257 @@ TEST(ZimCreatorFSTest, ParseRedirect)
     }
 }
 
+TEST(ZimCreatorFSTest, ParseRedirectInParallel)
+{
+  // Several chunks of 4 MiB
+  std::string data;
+  size_t lineCount = 0;
+  while (data.size() < 10*1024*1024) {
+    data += "A/" + std::to_string(lineCount) + "\tTitle\tA/target\n";
+    ++lineCount;
+  }
+
+  std::vector<std::string> paths;
+  parse_redirectArticles(data, [&](Redirect redirect) { paths.push_back(redirect.path); }, 4);
+  ASSERT_EQ(paths.size(), lineCount);
+  for (size_t i = 0; i < lineCount; ++i) {
+    ASSERT_EQ(paths[i], "A/" + std::to_string(i));
+  }
+
+  // Read by blocks from a stream, the lines across two blocks are kept whole
+  std::istringstream in(data);
+  paths.clear();
+  parse_redirectArticles(in, [&](Redirect redirect) { paths.push_back(redirect.path); }, 4);
+  ASSERT_EQ(paths.size(), lineCount);
+  for (size_t i = 0; i < lineCount; ++i) {
+    ASSERT_EQ(paths[i], "A/" + std::to_string(i));
+  }
+
+  // The lines before the invalid one are handled
+  const size_t invalidLineNumber = lineCount - 10;
+  const size_t invalidLineStart = data.find("A/" + std::to_string(invalidLineNumber - 1) + "\t");
+  data.replace(invalidLineStart, data.find('\n', invalidLineStart) - invalidLineStart, "A/path\tOups, no target");
+  paths.clear();
+  try {
+    parse_redirectArticles(data, [&](Redirect redirect) { paths.push_back(redirect.path); }, 4);
+    FAIL() << "Invalid line not reported";
+  } catch (const std::runtime_error& e) {
+    EXPECT_EQ(std::string(e.what()), "Invalid line #" + std::to_string(invalidLineNumber) + " : 'A/path\tOups, no target'");
+  }
+  EXPECT_EQ(paths.size(), invalidLineNumber - 1);
+
+  std::istringstream invalidIn(data);
+  paths.clear();
+  try {
+    parse_redirectArticles(invalidIn, [&](Redirect redirect) { paths.push_back(redirect.path); }, 4);
+    FAIL() << "Invalid line not reported";
+  } catch (const std::runtime_error& e) {
+    EXPECT_EQ(std::string(e.what()), "Invalid line #" + std::to_string(invalidLineNumber) + " : 'A/path\tOups, no target'");
+  }
+  EXPECT_EQ(paths.size(), invalidLineNumber - 1);
+}
+
+
+namespace
+{
+
+// A member of a tar archive (ustar header followed by its padded content)
+std::string tarMember(const std::string& path, char type, const std::string& content = "",
+                      const std::string& linkTarget = "")
+{
+  std::string header(512, '\0');
+  auto setField = [&](size_t offset, const std::string& value) {
+    header.replace(offset, value.size(), value);
+  };
+  auto octal = [](uint64_t value, size_t width) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%0*llo", int(width - 1), (unsigned long long)value);
+    return std::string(buf);
+  };
+  setField(0, path.substr(0, 100));
+  setField(100, octal(0644, 8));
+  setField(124, octal(content.size(), 12));
+  setField(136, octal(0, 12));
+  header[156] = type;
+  setField(157, linkTarget);
+  setField(257, std::string("ustar\0" "00", 8));
+  setField(148, "        ");
+  unsigned checksum = 0;
+  for (char c : header)
+    checksum += static_cast<unsigned char>(c);
+  setField(148, octal(checksum, 7));
+
+  return header + content + std::string((512 - content.size() % 512) % 512, '\0');
+}
+
+// A member with a GNU long name
+std::string tarLongMember(const std::string& path, char type, const std::string& content = "")
+{
+  return tarMember("././@LongLink", 'L', path + '\0') + tarMember(path.substr(0, 100), type, content);
+}
+
+std::string tarEnd()
+{
+  return std::string(1024, '\0');
+}
+
+} // unnamed namespace
+
+TEST(TarReaderTest, ReadsTheMembers)
+{
+  const std::string longPath = "dir/" + std::string(150, 'a') + ".html";
+  std::stringstream ss(
+      tarMember("./dir/", '5')
+    + tarMember("./dir/file.txt", '0', "content of file.txt")
+    + tarMember("./skipped.txt", '0', std::string(1000, 'x'))
+    + tarLongMember(longPath, '0', "long")
+    + tarMember("./link.txt", '2', "", "dir/file.txt")
+    + tarMember("./hardlink.txt", '1', "", "./dir/file.txt")
+    + tarMember("./fifo", '6')
+    + tarEnd());
+
+  TarReader tar(ss);
+  TarReader::Member member;
+  ASSERT_TRUE(tar.next(member));
+  EXPECT_EQ(member.type, TarReader::Member::Type::DIRECTORY);
+  EXPECT_EQ(member.path, "dir");
+
+  ASSERT_TRUE(tar.next(member));
+  EXPECT_EQ(member.type, TarReader::Member::Type::FILE);
+  EXPECT_EQ(member.path, "dir/file.txt");
+  ASSERT_EQ(member.size, 19u);
+  std::string content(member.size, '\0');
+  EXPECT_EQ(tar.read(&content[0], 10), 10u);
+  EXPECT_EQ(tar.read(&content[10], 100), 9u);
+  EXPECT_EQ(tar.read(&content[0], 100), 0u);
+  EXPECT_EQ(content, "content of file.txt");
+
+  // The content which isn't read is skipped
+  ASSERT_TRUE(tar.next(member));
+  EXPECT_EQ(member.path, "skipped.txt");
+  EXPECT_EQ(member.size, 1000u);
+
+  ASSERT_TRUE(tar.next(member));
+  EXPECT_EQ(member.type, TarReader::Member::Type::FILE);
+  EXPECT_EQ(member.path, longPath);
+  content.resize(member.size);
+  EXPECT_EQ(tar.read(&content[0], content.size()), 4u);
+  EXPECT_EQ(content, "long");
+
+  ASSERT_TRUE(tar.next(member));
+  EXPECT_EQ(member.type, TarReader::Member::Type::SYMLINK);
+  EXPECT_EQ(member.path, "link.txt");
+  EXPECT_EQ(member.linkTarget, "dir/file.txt");
+
+  ASSERT_TRUE(tar.next(member));
+  EXPECT_EQ(member.type, TarReader::Member::Type::HARDLINK);
+  EXPECT_EQ(member.path, "hardlink.txt");
+  EXPECT_EQ(member.linkTarget, "dir/file.txt");
+
+  ASSERT_TRUE(tar.next(member));
+  EXPECT_EQ(member.type, TarReader::Member::Type::OTHER);
+
+  EXPECT_FALSE(tar.next(member));
+}
+
+TEST(TarReaderTest, NormalizesThePaths)
+{
+  std::stringstream ss(
+      tarMember("./a/./b/../c.txt", '0', "c")
+    + tarMember("../outside.txt", '0', std::string(1000, 'x'))
+    + tarMember("a/../../outside.txt", '0', "x")
+    + tarMember("/abs//d.txt", '0', "d")
+    + tarMember("hardlink.txt", '1', "", "a/b/../c.txt")
+    + tarMember("outside-link.txt", '1', "", "../c.txt")
+    + tarEnd());
+
+  TarReader tar(ss);
+  TarReader::Member member;
+  ASSERT_TRUE(tar.next(member));
+  EXPECT_EQ(member.path, "a/c.txt");
+
+  // The members climbing out of the root are skipped
+  ASSERT_TRUE(tar.next(member));
+  EXPECT_EQ(member.path, "abs/d.txt");
+  std::string content(member.size, '\0');
+  EXPECT_EQ(tar.read(&content[0], content.size()), 1u);
+  EXPECT_EQ(content, "d");
+
+  ASSERT_TRUE(tar.next(member));
+  EXPECT_EQ(member.path, "hardlink.txt");
+  EXPECT_EQ(member.linkTarget, "a/c.txt");
+
+  ASSERT_TRUE(tar.next(member));
+  EXPECT_EQ(member.path, "outside-link.txt");
+  EXPECT_EQ(member.linkTarget, "../c.txt");
+
+  EXPECT_FALSE(tar.next(member));
+}
+
+TEST(TarReaderTest, ThrowsOnInvalidArchives)
+{
+  TarReader::Member member;
+  {
+    std::string data = tarMember("file.txt", '0', "content") + tarEnd();
+    data[0] = 'F';
+    std::stringstream ss(data);
+    TarReader tar(ss);
+    EXPECT_THROW(tar.next(member), std::runtime_error);
+  }
+  {
+    std::stringstream ss(tarMember("file.txt", '0', std::string(2000, 'x')).substr(0, 1024));
+    TarReader tar(ss);
+    ASSERT_TRUE(tar.next(member));
+    EXPECT_THROW(tar.next(member), std::runtime_error);
+  }
+}
+
+TEST(ZimCreatorFSTest, AddsTheContentOfATarArchive)
+{
+  const std::string bigContent(5*1024*1024, 'b');
+  std::stringstream ss(
+      tarMember("./", '5')
+    + tarMember("./index.html", '0', "<html><head><title>Index</title></head></html>")
+    + tarMember("./dir/", '5')
+    + tarMember("./dir/up.html", '2', "", "../index.html")
+    + tarMember("./dir/style.css", '0', "body {}")
+    + tarMember("./dir/big.txt", '0', bigContent)
+    + tarMember("./link.html", '2', "", "dir/up.html")
+    + tarMember("./hardlink.css", '1', "", "./dir/style.css")
+    + tarMember("./dangling.html", '2', "", "missing.html")
+    + tarMember("./outside.html", '2', "", "../index.html")
+    + tarMember("./dirlink", '2', "", "dir")
+    + tarMember("./implied/page.html", '0', "<html><head><title>Page</title></head></html>")
+    + tarMember("./impliedlink", '2', "", "implied")
+    + tarEnd());
+
+  ZimCreatorFS zimCreator("");
+  zimCreator.setMainPath("index.html");
+  TempFile out("tar-archive.zim");
+  zimCreator.startZimCreation(out.path());
+  zimCreator.visitTar(ss);
+  zimCreator.checkRedirectTargets();
+  zimCreator.finishZimCreation();
+
+  zim::Archive archive(out.path());
+  EXPECT_EQ(archive.getEntryByPath("index.html").getTitle(), "Index");
+  EXPECT_EQ(std::string(archive.getEntryByPath("dir/style.css").getItem().getData()), "body {}");
+  EXPECT_EQ(archive.getEntryByPath("dir/style.css").getItem().getMimetype(), "text/css");
+  EXPECT_EQ(std::string(archive.getEntryByPath("dir/big.txt").getItem().getData()), bigContent);
+
+  EXPECT_TRUE(archive.getEntryByPath("dir/up.html").isRedirect());
+  EXPECT_EQ(archive.getEntryByPath("dir/up.html").getRedirectEntry().getPath(), "index.html");
+  EXPECT_TRUE(archive.getEntryByPath("link.html").isRedirect());
+  EXPECT_EQ(archive.getEntryByPath("link.html").getRedirectEntry().getPath(), "index.html");
+  EXPECT_TRUE(archive.getEntryByPath("hardlink.css").isRedirect());
+  EXPECT_EQ(archive.getEntryByPath("hardlink.css").getRedirectEntry().getPath(), "dir/style.css");
+
+  EXPECT_FALSE(archive.hasEntryByPath("dangling.html"));
+  EXPECT_FALSE(archive.hasEntryByPath("outside.html"));
+  EXPECT_FALSE(archive.hasEntryByPath("dirlink"));
+  EXPECT_EQ(archive.getEntryByPath("implied/page.html").getTitle(), "Page");
+  EXPECT_FALSE(archive.hasEntryByPath("impliedlink"));
+}
 
 TEST(ZimwriterfsTools, extractRedirectUrlFromHtmlHeadValue)
 {
@@ -190,3 +728,259 @@ TEST(ZimwriterfsTools, extractRedirectUrlFromHtmlHeadValue)
   EXPECT_EQ(extractRedirectUrlFromHtmlHeadValue("0.5;url=\"//kiwix.org/privacy\" "), "//kiwix.org/privacy");
   EXPECT_EQ(extractRedirectUrlFromHtmlHeadValue("0;./Elizabeth_II"), "./Elizabeth_II");
 }
+
+namespace
+{
+
+// Returns the title and the refresh values found by scanHtmlHead() or
+// "GUMBO" if the document has to be parsed with Gumbo
+std::string scanHead(const std::string& html)
+{
+  HtmlHead head;
+  if ( !scanHtmlHead(html, head) )
+    return "GUMBO";
+
+  std::string result = head.title;
+  for (const auto& refreshValue : head.refreshValues) {
+    result += "|" + refreshValue;
+  }
+  return result;
+}
+
+} // unnamed namespace
+
+TEST(ZimwriterfsTools, scanHtmlHead)
+{
+  EXPECT_EQ(scanHead(""), "");
+  EXPECT_EQ(scanHead("<html><head><title>Title</title></head><body></body></html>"), "Title");
+  EXPECT_EQ(scanHead("<!DOCTYPE html>\n<HTML lang=en>\n<Head>\n<TITLE>Title</TITLE>"), "Title");
+  EXPECT_EQ(scanHead("<title>Caf&eacute; &amp; Co&#x2F;</title>"), "Café & Co/");
+  EXPECT_EQ(scanHead("<title> <b>Not a tag</b> </title>"), " <b>Not a tag</b> ");
+  EXPECT_EQ(scanHead("<title>Line\r\nBreaks\r</title >"), "Line\nBreaks\n");
+  EXPECT_EQ(scanHead("<title>First</title><title>Second</title>"), "Second");
+  EXPECT_EQ(scanHead("<title>Title</title><title> \n </title><title></title>"), "Title");
+
+  // The title after </head> still goes into the head...
+  EXPECT_EQ(scanHead("<head></head><title>Title</title>"), "Title");
+  // ... but not after the start of the body
+  EXPECT_EQ(scanHead("<head></head><body><title>Title</title>"), "");
+  EXPECT_EQ(scanHead("<head></head><div><title>Title</title>"), "");
+  EXPECT_EQ(scanHead("<head></head>text<title>Title</title>"), "");
+  EXPECT_EQ(scanHead("<head></head>&nbsp;<title>Title</title>"), "");
+  EXPECT_EQ(scanHead("<head></head></body><title>Title</title>"), "");
+  EXPECT_EQ(scanHead("<head></head>< title>Title</title>"), "");
+
+  // Comments and the content of scripts and styles are skipped
+  EXPECT_EQ(scanHead("<!-- <title>Wrong</title> --><title>Title</title>"), "Title");
+  EXPECT_EQ(scanHead("<!--><title>Title</title>"), "Title");
+  EXPECT_EQ(scanHead("<!---><title>Title</title>"), "Title");
+  EXPECT_EQ(scanHead("<!-- a --!><title>Title</title>"), "Title");
+  EXPECT_EQ(scanHead("<!-- <title>Wrong</title>"), "");
+  EXPECT_EQ(scanHead("<?xml version=\"1.0\"?><title>Title</title>"), "Title");
+  EXPECT_EQ(scanHead("<script>document.write('<title>Wrong</title>')</script ><title>Title</title>"), "Title");
+  EXPECT_EQ(scanHead("<style>body > p { color: red }</STYLE><title>Title</title>"), "Title");
+  EXPECT_EQ(scanHead("<link rel=stylesheet href=style.css><meta charset=utf-8><title>Title</title>"), "Title");
+
+  EXPECT_EQ(scanHead("<meta http-equiv=\"refresh\" content=\"0;URL=target.html\">"), "|0;URL=target.html");
+  EXPECT_EQ(scanHead("<meta content='0;URL=a&amp;b' http-equiv='refresh'/>"), "|0;URL=a&b");
+  EXPECT_EQ(scanHead("<META HTTP-EQUIV=refresh CONTENT=0;URL=target.html>"), "|0;URL=target.html");
+  EXPECT_EQ(scanHead("<meta http-equiv=\"Refresh\" content=\"0;URL=target.html\">"), "");
+  EXPECT_EQ(scanHead("<meta http-equiv=\"refresh\">"), "");
+  EXPECT_EQ(scanHead("<meta http-equiv=\"refresh\" content>"), "|");
+  EXPECT_EQ(scanHead("<meta http-equiv=\"refresh\" content=\"1;a\" content=\"2;b\">"), "|1;a");
+  EXPECT_EQ(scanHead("<body><meta http-equiv=\"refresh\" content=\"0;a\">"), "");
+
+  // Left to Gumbo
+  EXPECT_EQ(scanHead("\xEF\xBB\xBF<title>Title</title>"), "GUMBO");
+  EXPECT_EQ(scanHead("<title>Unterminated"), "GUMBO");
+  EXPECT_EQ(scanHead("<title>Invalid \xFF UTF-8</title>"), "GUMBO");
+  EXPECT_EQ(scanHead("<noscript><title>Title</title></noscript>"), "GUMBO");
+  EXPECT_EQ(scanHead("<script><!--<script></script>--></script>"), "GUMBO");
+  EXPECT_EQ(scanHead("<meta http-equiv=\"refresh"), "GUMBO");
+
+  // Like Gumbo, the scanner stops at the first NUL
+  EXPECT_EQ(scanHead(std::string("<title>Title</title>\0<title>Wrong</title>", 41)), "Title");
+}
+
+TEST(ZimwriterfsTools, scanHtmlHeadStopsAtTheBody)
+{
+  const std::string page = "<html><head><title>T</title></head><body><p>Text</p></body></html>";
+  HtmlHead head;
+  size_t headEnd = 0;
+  ASSERT_TRUE(scanHtmlHead(page, head, &headEnd));
+  EXPECT_EQ(page.substr(headEnd), "<p>Text</p></body></html>");
+
+  // The scan of an incomplete head ends at the end of the text
+  ASSERT_TRUE(scanHtmlHead(page.substr(0, 28), head, &headEnd));
+  EXPECT_EQ(headEnd, 28u);
+  ASSERT_TRUE(scanHtmlHead("<title>T</title><!-- unterminated", head, &headEnd));
+  EXPECT_EQ(headEnd, 33u);
+}
+
+TEST(ZimwriterfsTools, getHtmlFileHead)
+{
+  const std::string body = "<body>" + std::string(100*1024, 'x') + "</body>";
+  const std::string smallHead = "<head><title>Title</title></head>";
+  const std::string bigHead = "<head><script>" + std::string(100*1024, ' ') + "</script></head>";
+
+  HtmlHead head;
+  bool headScanned = false;
+
+  TempFile smallFile("small.html");
+  std::ofstream(smallFile.path()) << smallHead;
+  EXPECT_EQ(getHtmlFileHead(smallFile.path(), head, headScanned), smallHead);
+  EXPECT_TRUE(headScanned);
+  EXPECT_EQ(head.title, "Title");
+
+  TempFile pageWithSmallHead("small-head.html");
+  std::ofstream(pageWithSmallHead.path()) << smallHead << body;
+  EXPECT_EQ(getHtmlFileHead(pageWithSmallHead.path(), head, headScanned),
+            (smallHead + body).substr(0, 64*1024));
+  EXPECT_TRUE(headScanned);
+  EXPECT_EQ(head.title, "Title");
+
+  TempFile pageWithBigHead("big-head.html");
+  std::ofstream(pageWithBigHead.path()) << bigHead << "<title>Big</title>" << body;
+  EXPECT_EQ(getHtmlFileHead(pageWithBigHead.path(), head, headScanned),
+            bigHead + "<title>Big</title>" + body);
+  EXPECT_TRUE(headScanned);
+  EXPECT_EQ(head.title, "Big");
+
+  const std::string bigComment = "<!--" + std::string(100*1024, ' ') + "-->";
+  TempFile pageWithBigComment("big-comment.html");
+  std::ofstream(pageWithBigComment.path()) << bigComment << "<title>Commented</title>" << body;
+  EXPECT_EQ(getHtmlFileHead(pageWithBigComment.path(), head, headScanned),
+            bigComment + "<title>Commented</title>" + body);
+  EXPECT_TRUE(headScanned);
+  EXPECT_EQ(head.title, "Commented");
+
+  // Left to Gumbo
+  TempFile pageWithNoscript("noscript.html");
+  std::ofstream(pageWithNoscript.path()) << "<noscript><title>Title</title></noscript>";
+  EXPECT_EQ(getHtmlFileHead(pageWithNoscript.path(), head, headScanned),
+            "<noscript><title>Title</title></noscript>");
+  EXPECT_FALSE(headScanned);
+}
+
+TEST(ZimwriterfsTools, getFileDigest)
+{
+  const auto hexDigest = [](const std::string& content) {
+    TempFile file("digest.bin");
+    std::ofstream(file.path(), std::ios::binary) << content;
+    std::string digest;
+    uint64_t size = 0;
+    EXPECT_TRUE(getFileDigest(file.path(), digest, size));
+    EXPECT_EQ(size, content.size());
+    std::ostringstream hex;
+    for (const char c : digest) {
+      hex << std::hex << std::setw(2) << std::setfill('0') << int(static_cast<unsigned char>(c));
+    }
+    return hex.str();
+  };
+
+  // The test vectors of FIPS 180-2
+  EXPECT_EQ(hexDigest(""), "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+  EXPECT_EQ(hexDigest("abc"), "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+  EXPECT_EQ(hexDigest("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"),
+            "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+  EXPECT_EQ(hexDigest(std::string(1000000, 'a')),
+            "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+
+  std::string digest;
+  uint64_t size;
+  EXPECT_FALSE(getFileDigest("/non-existing-file", digest, size));
+}
+
+TEST(ZimwriterfsTools, getMimeTypeFromExtension)
+{
+  EXPECT_EQ(getMimeTypeFromExtension("html"), "text/html");
+  EXPECT_EQ(getMimeTypeFromExtension("HTM"), "text/html");
+  EXPECT_EQ(getMimeTypeFromExtension("collection"), "font/collection");
+  EXPECT_EQ(getMimeTypeFromExtension("woff2"), "font/woff2");
+  EXPECT_EQ(getMimeTypeFromExtension("zip"), "application/zip");
+  EXPECT_EQ(getMimeTypeFromExtension("woff3"), "");
+  EXPECT_EQ(getMimeTypeFromExtension("a"), "");
+  EXPECT_EQ(getMimeTypeFromExtension(""), "");
+}
+
+TEST(ZimwriterfsTools, getMimeTypeFromContent)
+{
+  const std::string html = "<!DOCTYPE html>\n<html><head><title>Title</title></head><body></body></html>\n";
+  const std::string png = "\x89PNG\r\n\x1a\n" + std::string("\0\0\0\x0dIHDR\0\0\0\x10\0\0\0\x10\x08\x06\0\0\0", 21);
+
+  std::vector<std::thread> threads;
+  std::vector<std::string> results(8);
+  for (size_t i = 0; i < results.size(); ++i) {
+    threads.emplace_back([&, i]() {
+      results[i] = getMimeTypeFromContent(i % 2 ? png : html);
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (size_t i = 0; i < results.size(); ++i) {
+    EXPECT_EQ(results[i], i % 2 ? "image/png" : "text/html");
+  }
+}
+
+namespace
+{
+
+// Compresses data in the gzip (or else zlib) format
+std::string deflateString(const std::string& data, bool gzip)
+{
+  z_stream zs = z_stream();
+  deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, gzip ? 15 + 16 : 15, 8, Z_DEFAULT_STRATEGY);
+  std::string output(deflateBound(&zs, data.size()), '\0');
+  zs.next_in = (Bytef*)data.data();
+  zs.avail_in = data.size();
+  zs.next_out = (Bytef*)&output[0];
+  zs.avail_out = output.size();
+  deflate(&zs, Z_FINISH);
+  output.resize(zs.total_out);
+  deflateEnd(&zs);
+  return output;
+}
+
+} // unnamed namespace
+
+TEST(ZimwriterfsTools, inflateFileContent)
+{
+  std::string page = "<html><head><title>Title</title></head><body>";
+  for (int i = 0; page.size() < 1024*1024; ++i) {
+    page += "<p>Paragraph #" + std::to_string(i) + "</p>";
+  }
+
+  std::string content;
+  TempFile gzipFile("page.html.gz");
+  std::ofstream(gzipFile.path()) << deflateString(page, true);
+  EXPECT_TRUE(inflateFileContent(gzipFile.path(), content));
+  EXPECT_EQ(content, page);
+
+  TempFile zlibFile("page.html");
+  std::ofstream(zlibFile.path()) << deflateString(page, false);
+  EXPECT_TRUE(inflateFileContent(zlibFile.path(), content));
+  EXPECT_EQ(content, page);
+
+  TempFile emptyFile("empty.html.gz");
+  std::ofstream(emptyFile.path()) << deflateString("", true);
+  EXPECT_TRUE(inflateFileContent(emptyFile.path(), content));
+  EXPECT_EQ(content, "");
+
+  TempFile truncatedFile("truncated.html.gz");
+  std::ofstream(truncatedFile.path()) << deflateString(page, true).substr(0, 1000);
+  EXPECT_THROW(inflateFileContent(truncatedFile.path(), content), std::runtime_error);
+
+  // Not compressed: left alone
+  content = "unchanged";
+  TempFile uncompressedFile("uncompressed.html");
+  std::ofstream(uncompressedFile.path()) << page;
+  EXPECT_FALSE(inflateFileContent(uncompressedFile.path(), content));
+  TempFile tinyFile("tiny.html");
+  std::ofstream(tinyFile.path()) << "x";
+  EXPECT_FALSE(inflateFileContent(tinyFile.path(), content));
+  EXPECT_EQ(content, "unchanged");
+
+  EXPECT_THROW(inflateFileContent("/tmp/no-such-file.gz", content), std::runtime_error);
+}